@@ -178,12 +178,7 @@ bool CV8ResourceImpl::Stop()
 
     // runtime->GetInspector()->contextDestroyed(context.Get(isolate));
 
-    for(auto pair : timers)
-    {
-        delete pair.second;
-    }
-    timers.clear();
-    oldTimers.clear();
+    ClearTimers();
 
     for(auto worker : workers)
     {
@@ -221,6 +216,8 @@ bool CV8ResourceImpl::Stop()
         DispatchStopEvent();
     }
 
+    scriptNames.Clear();
+
     return true;
 }
 
@@ -237,42 +234,60 @@ bool CV8ResourceImpl::OnEvent(const alt::CEvent* e)
     V8::EventHandler* handler = V8::EventHandler::Get(e);
     if(!handler) return true;
 
-    // Generic event handler
+    auto evType = e->GetType();
+    bool isScriptEvent = evType == alt::CEvent::Type::CLIENT_SCRIPT_EVENT || evType == alt::CEvent::Type::SERVER_SCRIPT_EVENT;
+    bool local = evType == alt::CEvent::Type::CLIENT_SCRIPT_EVENT;
+
+    const std::vector<V8::EventCallback*>& genericCallbacks = isScriptEvent ? GetGenericHandlers(local) : V8::EventHandlerTable::Empty();
+    const std::vector<V8::EventCallback*>& callbacks = handler->GetCallbacks(this, e);
+
+    // Arguments are only materialized when a live callback is going to receive them
+    bool hasGeneric = V8::EventHandlerTable::HasLive(genericCallbacks);
+    bool hasSpecific = V8::EventHandlerTable::HasLive(callbacks);
+
+    if(hasGeneric || hasSpecific)
     {
-        auto evType = e->GetType();
-        if(evType == alt::CEvent::Type::CLIENT_SCRIPT_EVENT || evType == alt::CEvent::Type::SERVER_SCRIPT_EVENT)
+        // Generic handlers receive the event name as first argument, the arguments are converted once
+        // with the name in front and shifted away for the specific handlers. Changes made by generic handlers
+        // must not be visible to the specific ones, so they get their own objects created from the args cache
+        V8::EventArgs args(eventArgs);
+
+        if(hasGeneric)
         {
-            std::vector<V8::EventCallback*> callbacks;
             const char* eventName;
 
-            if(evType == alt::CEvent::Type::CLIENT_SCRIPT_EVENT)
-            {
-                callbacks = std::move(GetGenericHandlers(true));
-                eventName = static_cast<const alt::CClientScriptEvent*>(e)->GetName().CStr();
-            }
-            else if(evType == alt::CEvent::Type::SERVER_SCRIPT_EVENT)
-            {
-                callbacks = std::move(GetGenericHandlers(false));
+            if(local) eventName = static_cast<const alt::CClientScriptEvent*>(e)->GetName().CStr();
+            else
                 eventName = static_cast<const alt::CServerScriptEvent*>(e)->GetName().CStr();
-            }
 
-            if(callbacks.size() != 0)
-            {
-                auto evArgs = handler->GetArgs(this, e);
-                evArgs.insert(evArgs.begin(), V8_NEW_STRING(eventName));
+            args.push_back(V8_NEW_STRING(eventName));
+            handler->GetArgs(this, e, args);
 
-                InvokeEventHandlers(e, callbacks, evArgs);
+            InvokeEventHandlers(e, genericCallbacks, args);
+            args.Shift();
+
+            if(hasSpecific)
+            {
+                if(args.HasObjects())
+                {
+                    const alt::MValueArgs& scriptArgs =
+                      local ? static_cast<const alt::CClientScriptEvent*>(e)->GetArgs() : static_cast<const alt::CServerScriptEvent*>(e)->GetArgs();
+
+                    args.Resize(args.size() - scriptArgs.GetSize());
+                    CV8ScriptRuntime::Instance().GetArgsCache().Materialize(scriptArgs, args);
+                }
+                else
+                    ++eventArgsSkipped;
             }
         }
-    }
-
-    std::vector<V8::EventCallback*> callbacks = handler->GetCallbacks(this, e);
-    if(callbacks.size() > 0)
-    {
-        std::vector<v8::Local<v8::Value>> args = handler->GetArgs(this, e);
+        else
+            handler->GetArgs(this, e, args);
 
-        InvokeEventHandlers(e, callbacks, args);
+        if(hasSpecific) InvokeEventHandlers(e, callbacks, args);
     }
+    // Only counted when there were handlers, all of them removed since
+    else if(!genericCallbacks.empty() || !callbacks.empty())
+        ++eventArgsSkipped;
 
     // Dynamic imports
     {
@@ -294,49 +309,31 @@ bool CV8ResourceImpl::OnEvent(const alt::CEvent* e)
     return true;
 }
 
-std::vector<V8::EventCallback*> CV8ResourceImpl::GetWebViewHandlers(alt::Ref<alt::IWebView> view, const std::string& name)
+const std::vector<V8::EventCallback*>& CV8ResourceImpl::GetWebViewHandlers(alt::Ref<alt::IWebView> view, std::string_view name)
 {
-    std::vector<V8::EventCallback*> handlers;
-    auto it = webViewHandlers.find(view.Get());
-
-    if(it != webViewHandlers.end())
-    {
-        auto range = it->second.equal_range(name);
+    auto it = webViewHandlers.find(view);
 
-        for(auto it = range.first; it != range.second; ++it) handlers.push_back(&it->second);
-    }
+    if(it == webViewHandlers.end()) return V8::EventHandlerTable::Empty();
 
-    return handlers;
+    return it->second.Get(V8::EventIds::Find(name));
 }
 
-std::vector<V8::EventCallback*> CV8ResourceImpl::GetWebSocketClientHandlers(alt::Ref<alt::IWebSocketClient> webSocket, const std::string& name)
+const std::vector<V8::EventCallback*>& CV8ResourceImpl::GetWebSocketClientHandlers(alt::Ref<alt::IWebSocketClient> webSocket, std::string_view name)
 {
-    std::vector<V8::EventCallback*> handlers;
-    auto it = webSocketClientHandlers.find(webSocket.Get());
+    auto it = webSocketClientHandlers.find(webSocket);
 
-    if(it != webSocketClientHandlers.end())
-    {
-        auto range = it->second.equal_range(name);
-
-        for(auto it = range.first; it != range.second; ++it) handlers.push_back(&it->second);
-    }
+    if(it == webSocketClientHandlers.end()) return V8::EventHandlerTable::Empty();
 
-    return handlers;
+    return it->second.Get(V8::EventIds::Find(name));
 }
 
-std::vector<V8::EventCallback*> CV8ResourceImpl::GetAudioHandlers(alt::Ref<alt::IAudio> audio, const std::string& name)
+const std::vector<V8::EventCallback*>& CV8ResourceImpl::GetAudioHandlers(alt::Ref<alt::IAudio> audio, std::string_view name)
 {
-    std::vector<V8::EventCallback*> handlers;
-    auto it = audioHandlers.find(audio.Get());
+    auto it = audioHandlers.find(audio);
 
-    if(it != audioHandlers.end())
-    {
-        auto range = it->second.equal_range(name);
-
-        for(auto it = range.first; it != range.second; ++it) handlers.push_back(&it->second);
-    }
+    if(it == audioHandlers.end()) return V8::EventHandlerTable::Empty();
 
-    return handlers;
+    return it->second.Get(V8::EventIds::Find(name));
 }
 
 void CV8ResourceImpl::OnTick()
@@ -357,25 +354,9 @@ void CV8ResourceImpl::OnTick()
         Log::Warning << "Resource " << resource->GetName() << " tick was too long " << GetTime() - time << " ms" << Log::Endl;
     }
 
-    for(auto& view : webViewHandlers)
-    {
-        for(auto it = view.second.begin(); it != view.second.end();)
-        {
-            if(it->second.removed) it = view.second.erase(it);
-            else
-                ++it;
-        }
-    }
-
-    for(auto& webSocket : webSocketClientHandlers)
-    {
-        for(auto it = webSocket.second.begin(); it != webSocket.second.end();)
-        {
-            if(it->second.removed) it = webSocket.second.erase(it);
-            else
-                ++it;
-        }
-    }
+    for(auto& view : webViewHandlers) view.second.Compact();
+    for(auto& webSocket : webSocketClientHandlers) webSocket.second.Compact();
+    for(auto& audio : audioHandlers) audio.second.Compact();
 
     for(auto worker : workers)
     {
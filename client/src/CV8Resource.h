@@ -38,71 +38,44 @@ public:
     void OnPromiseRejectedWithNoHandler(v8::PromiseRejectMessage& data);
     void OnPromiseHandlerAdded(v8::PromiseRejectMessage& data);
 
-    void SubscribeWebView(alt::Ref<alt::IWebView> view, const std::string& evName, v8::Local<v8::Function> cb, V8::SourceLocation&& location, bool once = false)
+    void SubscribeWebView(alt::Ref<alt::IWebView> view, std::string_view evName, v8::Local<v8::Function> cb, V8::SourceLocation&& location, bool once = false)
     {
-        webViewHandlers[view].insert({ evName, V8::EventCallback{ isolate, cb, std::move(location), once } });
+        webViewHandlers[view].Subscribe(V8::EventIds::Get(evName), new V8::EventCallback{ isolate, cb, std::move(location), once });
     }
 
-    void UnsubscribeWebView(alt::Ref<alt::IWebView> view, const std::string& evName, v8::Local<v8::Function> cb)
+    void UnsubscribeWebView(alt::Ref<alt::IWebView> view, std::string_view evName, v8::Local<v8::Function> cb)
     {
         auto it = webViewHandlers.find(view);
-        if(it != webViewHandlers.end())
-        {
-            auto& viewEvents = it->second;
-            auto range = viewEvents.equal_range(evName);
-
-            for(auto it = range.first; it != range.second; ++it)
-            {
-                if(it->second.fn.Get(isolate)->StrictEquals(cb)) it->second.removed = true;
-            }
-        }
+        if(it != webViewHandlers.end()) it->second.Unsubscribe(V8::EventIds::Find(evName), isolate, cb);
     }
 
-    std::vector<V8::EventCallback*> GetWebViewHandlers(alt::Ref<alt::IWebView> view, const std::string& name);
+    const std::vector<V8::EventCallback*>& GetWebViewHandlers(alt::Ref<alt::IWebView> view, std::string_view name);
 
-    void SubscribeWebSocketClient(alt::Ref<alt::IWebSocketClient> webSocket, const std::string& evName, v8::Local<v8::Function> cb, V8::SourceLocation&& location)
+    void SubscribeWebSocketClient(alt::Ref<alt::IWebSocketClient> webSocket, std::string_view evName, v8::Local<v8::Function> cb, V8::SourceLocation&& location)
     {
-        webSocketClientHandlers[webSocket].insert({ evName, V8::EventCallback{ isolate, cb, std::move(location) } });
+        webSocketClientHandlers[webSocket].Subscribe(V8::EventIds::Get(evName), new V8::EventCallback{ isolate, cb, std::move(location) });
     }
 
-    void UnsubscribeWebSocketClient(alt::Ref<alt::IWebSocketClient> webSocket, const std::string& evName, v8::Local<v8::Function> cb)
+    void UnsubscribeWebSocketClient(alt::Ref<alt::IWebSocketClient> webSocket, std::string_view evName, v8::Local<v8::Function> cb)
     {
         auto it = webSocketClientHandlers.find(webSocket);
-        if(it != webSocketClientHandlers.end())
-        {
-            auto& webSocketEvents = it->second;
-            auto range = webSocketEvents.equal_range(evName);
-
-            for(auto it = range.first; it != range.second; ++it)
-            {
-                if(it->second.fn.Get(isolate)->StrictEquals(cb)) it->second.removed = true;
-            }
-        }
+        if(it != webSocketClientHandlers.end()) it->second.Unsubscribe(V8::EventIds::Find(evName), isolate, cb);
     }
 
-    std::vector<V8::EventCallback*> GetWebSocketClientHandlers(alt::Ref<alt::IWebSocketClient> webSocket, const std::string& name);
+    const std::vector<V8::EventCallback*>& GetWebSocketClientHandlers(alt::Ref<alt::IWebSocketClient> webSocket, std::string_view name);
 
-    void SubscribeAudio(alt::Ref<alt::IAudio> audio, const std::string& evName, v8::Local<v8::Function> cb, V8::SourceLocation&& location)
+    void SubscribeAudio(alt::Ref<alt::IAudio> audio, std::string_view evName, v8::Local<v8::Function> cb, V8::SourceLocation&& location)
     {
-        audioHandlers[audio].insert({ evName, V8::EventCallback{ isolate, cb, std::move(location) } });
+        audioHandlers[audio].Subscribe(V8::EventIds::Get(evName), new V8::EventCallback{ isolate, cb, std::move(location) });
     }
 
-    void UnsubscribeAudio(alt::Ref<alt::IAudio> audio, const std::string& evName, v8::Local<v8::Function> cb)
+    void UnsubscribeAudio(alt::Ref<alt::IAudio> audio, std::string_view evName, v8::Local<v8::Function> cb)
     {
         auto it = audioHandlers.find(audio);
-        if(it != audioHandlers.end())
-        {
-            auto& audioEvents = it->second;
-            auto range = audioEvents.equal_range(evName);
-
-            for(auto it = range.first; it != range.second; ++it)
-            {
-                if(it->second.fn.Get(isolate)->StrictEquals(cb)) it->second.removed = true;
-            }
-        }
+        if(it != audioHandlers.end()) it->second.Unsubscribe(V8::EventIds::Find(evName), isolate, cb);
     }
 
-    std::vector<V8::EventCallback*> GetAudioHandlers(alt::Ref<alt::IAudio> audio, const std::string& name);
+    const std::vector<V8::EventCallback*>& GetAudioHandlers(alt::Ref<alt::IAudio> audio, std::string_view name);
 
     void AddOwned(alt::Ref<alt::IBaseObject> handle)
     {
@@ -140,11 +113,9 @@ public:
     }
 
 private:
-    using WebViewEvents = std::unordered_multimap<std::string, V8::EventCallback>;
-
-    std::unordered_map<alt::Ref<alt::IWebView>, WebViewEvents> webViewHandlers;
-    std::unordered_map<alt::Ref<alt::IWebSocketClient>, WebViewEvents> webSocketClientHandlers;
-    std::unordered_map<alt::Ref<alt::IAudio>, WebViewEvents> audioHandlers;
+    std::unordered_map<alt::Ref<alt::IWebView>, V8::EventHandlerTable> webViewHandlers;
+    std::unordered_map<alt::Ref<alt::IWebSocketClient>, V8::EventHandlerTable> webSocketClientHandlers;
+    std::unordered_map<alt::Ref<alt::IAudio>, V8::EventHandlerTable> audioHandlers;
 
     std::unordered_set<alt::Ref<alt::IBaseObject>> ownedObjects;
 
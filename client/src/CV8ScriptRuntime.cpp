@@ -7,6 +7,9 @@
 
 CV8ScriptRuntime::CV8ScriptRuntime()
 {
+    // Fast API calls are still behind a flag in this V8 version
+    v8::V8::SetFlagsFromString("--turbo-fast-api-calls");
+
     platform = v8::platform::NewDefaultPlatform();
     v8::V8::InitializePlatform(platform.get());
     v8::V8::Initialize();
@@ -30,6 +30,8 @@ class CV8ScriptRuntime : public alt::IScriptRuntime
     std::unordered_map<uint16_t, alt::Ref<alt::IPlayer>> streamedInPlayers;
     std::unordered_map<uint16_t, alt::Ref<alt::IVehicle>> streamedInVehicles;
 
+    V8::MValueArgsCache argsCache;
+
 public:
     CV8ScriptRuntime();
 
@@ -44,6 +46,11 @@ public:
         return isolate;
     }
 
+    V8::MValueArgsCache& GetArgsCache()
+    {
+        return argsCache;
+    }
+
     v8_inspector::V8Inspector* GetInspector() const
     {
         return inspector.get();
@@ -89,6 +96,9 @@ public:
         v8::HandleScope handle_scope(isolate);
 
         v8::platform::PumpMessageLoop(platform.get(), isolate);
+
+        // Events of the last tick have been delivered to every resource
+        argsCache.Clear();
     }
 
     std::unordered_set<CV8ResourceImpl*> GetResources()
@@ -112,11 +122,14 @@ public:
         Log::Info << "peak_malloced_memory = " << FormatBytes(heapStats.peak_malloced_memory()) << Log::Endl;
         Log::Info << "number_of_native_contexts = " << heapStats.number_of_native_contexts() << Log::Endl;
         Log::Info << "number_of_detached_contexts = " << heapStats.number_of_detached_contexts() << Log::Endl;
+        for(auto resource : resources) resource->EntityBenchmark();
         Log::Info << "======================================================" << Log::Endl;
     }
 
     ~CV8ScriptRuntime()
     {
+        argsCache.Clear();
+
         while(isolate->IsInUse()) isolate->Exit();
         isolate->Dispose();
         v8::V8::Dispose();
@@ -116,7 +116,7 @@ static void AllGetter(v8::Local<v8::String> name, const v8::PropertyCallbackInfo
 {
     V8_GET_ISOLATE_CONTEXT_RESOURCE();
 
-    V8_RETURN(resource->GetAllBlips()->Clone());
+    V8_RETURN(resource->GetAllBlips());
 }
 
 extern V8Class v8WorldObject;
@@ -859,6 +859,44 @@ static void TotalPacketsLostGetter(v8::Local<v8::Name>, const v8::PropertyCallba
     V8_RETURN_UINT64(alt::ICore::Instance().GetTotalPacketsLost());
 }
 
+// Fast API variants of the functions scripts poll every tick (key, menu and focus state) or call per frame (rotation velocity).
+// TurboFan calls them directly once the caller is optimized and the argument count and types match, anything else
+// still goes through the slow callbacks
+static bool FastGameControlsEnabled(v8::Local<v8::Object>)
+{
+    return alt::ICore::Instance().AreControlsEnabled();
+}
+
+static bool FastIsMenuOpen(v8::Local<v8::Object>)
+{
+    return ICore::Instance().IsMenuOpen();
+}
+
+static bool FastIsConsoleOpen(v8::Local<v8::Object>)
+{
+    return ICore::Instance().IsConsoleOpen();
+}
+
+static bool FastIsKeyDown(v8::Local<v8::Object>, int32_t keycode)
+{
+    return alt::ICore::Instance().GetKeyState(keycode).IsDown();
+}
+
+static bool FastIsKeyToggled(v8::Local<v8::Object>, int32_t keycode)
+{
+    return alt::ICore::Instance().GetKeyState(keycode).IsToggled();
+}
+
+static void FastSetAngularVelocity(v8::Local<v8::Object>, int32_t id, double x, double y, double z)
+{
+    alt::ICore::Instance().SetAngularVelocity(id, { x, y, z, 0.0 });
+}
+
+static bool FastIsGameFocused(v8::Local<v8::Object>)
+{
+    return alt::ICore::Instance().IsGameFocused();
+}
+
 extern V8Module sharedModule;
 extern V8Class v8Player, v8Player, v8Vehicle, v8WebView, v8HandlingData, v8LocalStorage, v8MemoryBuffer, v8MapZoomData, v8Discord, v8Voice, v8WebSocketClient, v8Checkpoint, v8HttpClient,
   v8Audio, v8LocalPlayer, v8Profiler, v8Worker;
@@ -885,15 +923,15 @@ extern V8Module altModule("alt",
                               V8Helpers::RegisterFunc(exports, "onceServer", &OnceServer);
                               V8Helpers::RegisterFunc(exports, "offServer", &OffServer);
                               V8Helpers::RegisterFunc(exports, "emitServer", &EmitServer);
-                              V8Helpers::RegisterFunc(exports, "gameControlsEnabled", &GameControlsEnabled);
+                              V8Helpers::RegisterFastFunc(exports, "gameControlsEnabled", &GameControlsEnabled, V8_FAST_CALLBACK(FastGameControlsEnabled));
                               V8Helpers::RegisterFunc(exports, "toggleGameControls", &ToggleGameControls);
                               V8Helpers::RegisterFunc(exports, "toggleVoiceControls", &ToggleVoiceControls);
                               V8Helpers::RegisterFunc(exports, "showCursor", &ShowCursor);
 
                               V8Helpers::RegisterFunc(exports, "getCursorPos", &GetCursorPos);
                               V8Helpers::RegisterFunc(exports, "setCursorPos", &SetCursorPos);
-                              V8Helpers::RegisterFunc(exports, "isMenuOpen", &IsMenuOpen);
-                              V8Helpers::RegisterFunc(exports, "isConsoleOpen", &IsConsoleOpen);
+                              V8Helpers::RegisterFastFunc(exports, "isMenuOpen", &IsMenuOpen, V8_FAST_CALLBACK(FastIsMenuOpen));
+                              V8Helpers::RegisterFastFunc(exports, "isConsoleOpen", &IsConsoleOpen, V8_FAST_CALLBACK(FastIsConsoleOpen));
                               // V8Helpers::RegisterFunc(exports, "drawRect2D", &DrawRect2D);
 
                               V8Helpers::RegisterFunc(exports, "requestIpl", &RequestIPL);
@@ -932,8 +970,8 @@ extern V8Module altModule("alt",
                               V8Helpers::RegisterFunc(exports, "getStat", &GetCharStat);
                               V8Helpers::RegisterFunc(exports, "resetStat", &ResetCharStat);
 
-                              V8Helpers::RegisterFunc(exports, "isKeyDown", &IsKeyDown);
-                              V8Helpers::RegisterFunc(exports, "isKeyToggled", &IsKeyToggled);
+                              V8Helpers::RegisterFastFunc(exports, "isKeyDown", &IsKeyDown, V8_FAST_CALLBACK(FastIsKeyDown));
+                              V8Helpers::RegisterFastFunc(exports, "isKeyToggled", &IsKeyToggled, V8_FAST_CALLBACK(FastIsKeyToggled));
 
                               V8Helpers::RegisterFunc(exports, "setConfigFlag", &SetConfigFlag);
                               V8Helpers::RegisterFunc(exports, "getConfigFlag", &GetConfigFlag);
@@ -941,7 +979,7 @@ extern V8Module altModule("alt",
 
                               //   V8Helpers::RegisterFunc(exports, "getEntityMemoryByID", &GetEntityMemoryByID);
 
-                              V8Helpers::RegisterFunc(exports, "setRotationVelocity", &SetAngularVelocity);
+                              V8Helpers::RegisterFastFunc(exports, "setRotationVelocity", &SetAngularVelocity, V8_FAST_CALLBACK(FastSetAngularVelocity));
                               // V8Helpers::RegisterFunc(exports, "setAngularVelocity", &SetAngularVelocity);
 
                               V8Helpers::RegisterFunc(exports, "isInStreamerMode", &IsInStreamerMode);
@@ -950,7 +988,7 @@ extern V8Module altModule("alt",
                               V8Helpers::RegisterFunc(exports, "takeScreenshot", &TakeScreenshot);
                               V8Helpers::RegisterFunc(exports, "takeScreenshotGameOnly", &TakeScreenshotGameOnly);
 
-                              V8Helpers::RegisterFunc(exports, "isGameFocused", &IsGameFocused);
+                              V8Helpers::RegisterFastFunc(exports, "isGameFocused", &IsGameFocused, V8_FAST_CALLBACK(FastIsGameFocused));
 
                               V8Helpers::RegisterFunc(exports, "loadModel", &LoadModel);
                               V8Helpers::RegisterFunc(exports, "loadModelAsync", &LoadModelAsync);
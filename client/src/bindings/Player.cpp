@@ -62,7 +62,7 @@ static void AllGetter(v8::Local<v8::String> name, const v8::PropertyCallbackInfo
 {
     V8_GET_ISOLATE_CONTEXT_RESOURCE();
 
-    V8_RETURN(resource->GetAllPlayers()->Clone());
+    V8_RETURN(resource->GetAllPlayers());
 }
 
 static void StreamedInGetter(v8::Local<v8::String> name, const v8::PropertyCallbackInfo<v8::Value>& info)
@@ -96,6 +96,21 @@ static void StaticGetByScriptID(const v8::FunctionCallbackInfo<v8::Value>& info)
     V8_RETURN_BASE_OBJECT(alt::ICore::Instance().GetEntityByScriptGuid(scriptGuid).As<alt::IPlayer>());
 }
 
+static void StaticGetPositions(const v8::FunctionCallbackInfo<v8::Value>& info)
+{
+    V8::SnapshotPositions(info, alt::ICore::Instance().GetPlayers());
+}
+
+static void StaticGetRotations(const v8::FunctionCallbackInfo<v8::Value>& info)
+{
+    V8::SnapshotRotations(info, alt::ICore::Instance().GetPlayers());
+}
+
+static void StaticGetIds(const v8::FunctionCallbackInfo<v8::Value>& info)
+{
+    V8::SnapshotIds(info, alt::ICore::Instance().GetPlayers());
+}
+
 static void StaticGetByID(const v8::FunctionCallbackInfo<v8::Value>& info)
 {
     V8_GET_ISOLATE_CONTEXT_RESOURCE();
@@ -122,6 +137,9 @@ extern V8Class v8Player("Player", v8Entity, [](v8::Local<v8::FunctionTemplate> t
     V8::SetMethod(isolate, tpl, "toString", ToString);
 
     V8::SetStaticMethod(isolate, tpl, "getByID", StaticGetByID);
+    V8::SetStaticMethod(isolate, tpl, "getPositions", StaticGetPositions);
+    V8::SetStaticMethod(isolate, tpl, "getRotations", StaticGetRotations);
+    V8::SetStaticMethod(isolate, tpl, "getIds", StaticGetIds);
     V8::SetStaticMethod(isolate, tpl, "getByScriptID", StaticGetByScriptID);
 
     V8::SetStaticAccessor(isolate, tpl, "all", &AllGetter);
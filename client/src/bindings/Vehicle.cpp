@@ -66,7 +66,7 @@ static void AllGetter(v8::Local<v8::String> name, const v8::PropertyCallbackInfo
 {
     V8_GET_ISOLATE_CONTEXT_RESOURCE();
 
-    V8_RETURN(resource->GetAllVehicles()->Clone());
+    V8_RETURN(resource->GetAllVehicles());
 }
 
 static void StreamedInGetter(v8::Local<v8::String> name, const v8::PropertyCallbackInfo<v8::Value>& info)
@@ -93,6 +93,21 @@ static void StaticGetByScriptID(const v8::FunctionCallbackInfo<v8::Value>& info)
     V8_RETURN_BASE_OBJECT(alt::ICore::Instance().GetEntityByScriptGuid(scriptGuid).As<alt::IVehicle>());
 }
 
+static void StaticGetPositions(const v8::FunctionCallbackInfo<v8::Value>& info)
+{
+    V8::SnapshotPositions(info, alt::ICore::Instance().GetVehicles());
+}
+
+static void StaticGetRotations(const v8::FunctionCallbackInfo<v8::Value>& info)
+{
+    V8::SnapshotRotations(info, alt::ICore::Instance().GetVehicles());
+}
+
+static void StaticGetIds(const v8::FunctionCallbackInfo<v8::Value>& info)
+{
+    V8::SnapshotIds(info, alt::ICore::Instance().GetVehicles());
+}
+
 static void StaticGetByID(const v8::FunctionCallbackInfo<v8::Value>& info)
 {
     V8_GET_ISOLATE_CONTEXT_RESOURCE();
@@ -136,6 +151,9 @@ extern V8Class v8Vehicle("Vehicle", v8Entity, [](v8::Local<v8::FunctionTemplate>
     V8::SetMethod(isolate, tpl, "toString", ToString);
 
     V8::SetStaticMethod(isolate, tpl, "getByID", StaticGetByID);
+    V8::SetStaticMethod(isolate, tpl, "getPositions", StaticGetPositions);
+    V8::SetStaticMethod(isolate, tpl, "getRotations", StaticGetRotations);
+    V8::SetStaticMethod(isolate, tpl, "getIds", StaticGetIds);
     V8::SetStaticMethod(isolate, tpl, "getByScriptID", StaticGetByScriptID);
 
     V8::SetStaticAccessor(isolate, tpl, "all", &AllGetter);
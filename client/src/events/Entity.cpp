@@ -13,7 +13,7 @@
 using alt::CEvent;
 using EventType = CEvent::Type;
 
-V8_LOCAL_EVENT_HANDLER removeEntity(EventType::REMOVE_ENTITY_EVENT, "removeEntity", [](V8ResourceImpl* resource, const alt::CEvent* e, std::vector<v8::Local<v8::Value>>& args) {
+V8_LOCAL_EVENT_HANDLER removeEntity(EventType::REMOVE_ENTITY_EVENT, "removeEntity", [](V8ResourceImpl* resource, const alt::CEvent* e, V8::EventArgs& args) {
     auto ev = static_cast<const alt::CRemoveEntityEvent*>(e);
     v8::Isolate* isolate = resource->GetIsolate();
 
@@ -22,12 +22,13 @@ V8_LOCAL_EVENT_HANDLER removeEntity(EventType::REMOVE_ENTITY_EVENT, "removeEntit
 
 V8_EVENT_HANDLER gameEntityCreate(
   EventType::GAME_ENTITY_CREATE,
-  [](V8ResourceImpl* resource, const alt::CEvent* e) {
+  [](V8ResourceImpl* resource, const alt::CEvent* e) -> const std::vector<V8::EventCallback*>& {
+      static const uint32_t id = V8::EventIds::Get("gameEntityCreate");
       CV8ScriptRuntime::Instance().OnEntityStreamIn(static_cast<const alt::CGameEntityCreateEvent*>(e)->GetTarget());
 
-      return resource->GetLocalHandlers("gameEntityCreate");
+      return resource->GetLocalHandlers(id);
   },
-  [](V8ResourceImpl* resource, const alt::CEvent* e, std::vector<v8::Local<v8::Value>>& args) {
+  [](V8ResourceImpl* resource, const alt::CEvent* e, V8::EventArgs& args) {
       auto ev = static_cast<const alt::CGameEntityCreateEvent*>(e);
       v8::Isolate* isolate = resource->GetIsolate();
 
@@ -36,19 +37,20 @@ V8_EVENT_HANDLER gameEntityCreate(
 
 V8_EVENT_HANDLER gameEntityDestroy(
   EventType::GAME_ENTITY_DESTROY,
-  [](V8ResourceImpl* resource, const alt::CEvent* e) {
+  [](V8ResourceImpl* resource, const alt::CEvent* e) -> const std::vector<V8::EventCallback*>& {
+      static const uint32_t id = V8::EventIds::Get("gameEntityDestroy");
       CV8ScriptRuntime::Instance().OnEntityStreamOut(static_cast<const alt::CGameEntityDestroyEvent*>(e)->GetTarget());
 
-      return resource->GetLocalHandlers("gameEntityDestroy");
+      return resource->GetLocalHandlers(id);
   },
-  [](V8ResourceImpl* resource, const alt::CEvent* e, std::vector<v8::Local<v8::Value>>& args) {
+  [](V8ResourceImpl* resource, const alt::CEvent* e, V8::EventArgs& args) {
       auto ev = static_cast<const alt::CGameEntityDestroyEvent*>(e);
       v8::Isolate* isolate = resource->GetIsolate();
 
       args.push_back(resource->GetOrCreateEntity(ev->GetTarget().Get())->GetJSVal(isolate));
   });
 
-V8_LOCAL_EVENT_HANDLER taskChange(EventType::TASK_CHANGE, "taskChange", [](V8ResourceImpl* resource, const alt::CEvent* e, std::vector<v8::Local<v8::Value>>& args) {
+V8_LOCAL_EVENT_HANDLER taskChange(EventType::TASK_CHANGE, "taskChange", [](V8ResourceImpl* resource, const alt::CEvent* e, V8::EventArgs& args) {
     auto ev = static_cast<const alt::CTaskChangeEvent*>(e);
     v8::Isolate* isolate = resource->GetIsolate();
 
@@ -21,36 +21,39 @@ using EventType = CEvent::Type;
 
 V8_EVENT_HANDLER clientScriptEvent(
   EventType::CLIENT_SCRIPT_EVENT,
-  [](V8ResourceImpl* resource, const CEvent* e) {
+  [](V8ResourceImpl* resource, const CEvent* e) -> const std::vector<V8::EventCallback*>& {
       auto ev = static_cast<const alt::CClientScriptEvent*>(e);
-      return resource->GetLocalHandlers(ev->GetName().ToString());
+      const auto& name = ev->GetName();
+      return resource->GetLocalHandlers(std::string_view{ name.GetData(), name.GetSize() });
   },
-  [](V8ResourceImpl* resource, const CEvent* e, std::vector<v8::Local<v8::Value>>& args) {
+  [](V8ResourceImpl* resource, const CEvent* e, V8::EventArgs& args) {
       auto ev = static_cast<const alt::CClientScriptEvent*>(e);
 
-      V8Helpers::MValueArgsToV8(ev->GetArgs(), args);
+      CV8ScriptRuntime::Instance().GetArgsCache().Convert(ev->GetArgs(), args);
   });
 
 V8_EVENT_HANDLER serverScriptEvent(
   EventType::SERVER_SCRIPT_EVENT,
-  [](V8ResourceImpl* resource, const CEvent* e) {
+  [](V8ResourceImpl* resource, const CEvent* e) -> const std::vector<V8::EventCallback*>& {
       auto ev = static_cast<const alt::CServerScriptEvent*>(e);
-      return resource->GetRemoteHandlers(ev->GetName().ToString());
+      const auto& name = ev->GetName();
+      return resource->GetRemoteHandlers(std::string_view{ name.GetData(), name.GetSize() });
   },
-  [](V8ResourceImpl* resource, const CEvent* e, std::vector<v8::Local<v8::Value>>& args) {
+  [](V8ResourceImpl* resource, const CEvent* e, V8::EventArgs& args) {
       auto ev = static_cast<const alt::CServerScriptEvent*>(e);
 
-      V8Helpers::MValueArgsToV8(ev->GetArgs(), args);
+      CV8ScriptRuntime::Instance().GetArgsCache().Convert(ev->GetArgs(), args);
   });
 
 V8_EVENT_HANDLER webviewEvent(
   EventType::WEB_VIEW_EVENT,
-  [](V8ResourceImpl* resource, const CEvent* e) {
+  [](V8ResourceImpl* resource, const CEvent* e) -> const std::vector<V8::EventCallback*>& {
       auto ev = static_cast<const alt::CWebViewEvent*>(e);
+      const auto& name = ev->GetName();
 
-      return static_cast<CV8ResourceImpl*>(resource)->GetWebViewHandlers(ev->GetTarget(), ev->GetName().ToString());
+      return static_cast<CV8ResourceImpl*>(resource)->GetWebViewHandlers(ev->GetTarget(), std::string_view{ name.GetData(), name.GetSize() });
   },
-  [](V8ResourceImpl* resource, const CEvent* e, std::vector<v8::Local<v8::Value>>& args) {
+  [](V8ResourceImpl* resource, const CEvent* e, V8::EventArgs& args) {
       auto ev = static_cast<const alt::CWebViewEvent*>(e);
 
       V8Helpers::MValueArgsToV8(ev->GetArgs(), args);
@@ -58,12 +61,13 @@ V8_EVENT_HANDLER webviewEvent(
 
 V8_EVENT_HANDLER webSocketEvent(
   EventType::WEB_SOCKET_CLIENT_EVENT,
-  [](V8ResourceImpl* resource, const CEvent* e) {
+  [](V8ResourceImpl* resource, const CEvent* e) -> const std::vector<V8::EventCallback*>& {
       auto ev = static_cast<const alt::CWebSocketClientEvent*>(e);
+      const auto& name = ev->GetName();
 
-      return static_cast<CV8ResourceImpl*>(resource)->GetWebSocketClientHandlers(ev->GetTarget(), ev->GetName().ToString());
+      return static_cast<CV8ResourceImpl*>(resource)->GetWebSocketClientHandlers(ev->GetTarget(), std::string_view{ name.GetData(), name.GetSize() });
   },
-  [](V8ResourceImpl* resource, const CEvent* e, std::vector<v8::Local<v8::Value>>& args) {
+  [](V8ResourceImpl* resource, const CEvent* e, V8::EventArgs& args) {
       auto ev = static_cast<const alt::CWebSocketClientEvent*>(e);
 
       V8Helpers::MValueArgsToV8(ev->GetArgs(), args);
@@ -71,12 +75,13 @@ V8_EVENT_HANDLER webSocketEvent(
 
 V8_EVENT_HANDLER audioEvent(
   EventType::AUDIO_EVENT,
-  [](V8ResourceImpl* resource, const CEvent* e) {
+  [](V8ResourceImpl* resource, const CEvent* e) -> const std::vector<V8::EventCallback*>& {
       auto ev = static_cast<const alt::CAudioEvent*>(e);
+      const auto& name = ev->GetName();
 
-      return static_cast<CV8ResourceImpl*>(resource)->GetAudioHandlers(ev->GetTarget(), ev->GetName().ToString());
+      return static_cast<CV8ResourceImpl*>(resource)->GetAudioHandlers(ev->GetTarget(), std::string_view{ name.GetData(), name.GetSize() });
   },
-  [](V8ResourceImpl* resource, const CEvent* e, std::vector<v8::Local<v8::Value>>& args) {
+  [](V8ResourceImpl* resource, const CEvent* e, V8::EventArgs& args) {
       auto ev = static_cast<const alt::CAudioEvent*>(e);
 
       V8Helpers::MValueArgsToV8(ev->GetArgs(), args);
@@ -84,25 +89,27 @@ V8_EVENT_HANDLER audioEvent(
 
 V8_EVENT_HANDLER keyboardEvent(
   EventType::KEYBOARD_EVENT,
-  [](V8ResourceImpl* resource, const CEvent* e) {
+  [](V8ResourceImpl* resource, const CEvent* e) -> const std::vector<V8::EventCallback*>& {
+      static const uint32_t keyupId = V8::EventIds::Get("keyup");
+      static const uint32_t keydownId = V8::EventIds::Get("keydown");
       auto ev = static_cast<const alt::CKeyboardEvent*>(e);
-      if(ev->GetKeyState() == alt::CKeyboardEvent::KeyState::UP) return resource->GetLocalHandlers("keyup");
+      if(ev->GetKeyState() == alt::CKeyboardEvent::KeyState::UP) return resource->GetLocalHandlers(keyupId);
       else if(ev->GetKeyState() == alt::CKeyboardEvent::KeyState::DOWN)
-          return resource->GetLocalHandlers("keydown");
+          return resource->GetLocalHandlers(keydownId);
       else
       {
           Log::Error << "Unhandled keystate in keyboard event handler: " << (int)ev->GetKeyState() << Log::Endl;
-          return std::vector<V8::EventCallback*>();
+          return V8::EventHandlerTable::Empty();
       }
   },
-  [](V8ResourceImpl* resource, const CEvent* e, std::vector<v8::Local<v8::Value>>& args) {
+  [](V8ResourceImpl* resource, const CEvent* e, V8::EventArgs& args) {
       auto ev = static_cast<const alt::CKeyboardEvent*>(e);
       v8::Isolate* isolate = resource->GetIsolate();
 
       args.push_back(V8::JSValue(ev->GetKeyCode()));
   });
 
-V8_LOCAL_EVENT_HANDLER connectionComplete(EventType::CONNECTION_COMPLETE, "connectionComplete", [](V8ResourceImpl* resource, const alt::CEvent* e, std::vector<v8::Local<v8::Value>>& args) {
+V8_LOCAL_EVENT_HANDLER connectionComplete(EventType::CONNECTION_COMPLETE, "connectionComplete", [](V8ResourceImpl* resource, const alt::CEvent* e, V8::EventArgs& args) {
 });
 
-V8_LOCAL_EVENT_HANDLER disconnect(EventType::DISCONNECT_EVENT, "disconnect", [](V8ResourceImpl* resource, const alt::CEvent* e, std::vector<v8::Local<v8::Value>>& args) {});
+V8_LOCAL_EVENT_HANDLER disconnect(EventType::DISCONNECT_EVENT, "disconnect", [](V8ResourceImpl* resource, const alt::CEvent* e, V8::EventArgs& args) {});
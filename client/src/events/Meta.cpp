@@ -11,7 +11,7 @@
 using alt::CEvent;
 using EventType = CEvent::Type;
 
-V8_LOCAL_EVENT_HANDLER syncedMetaChange(EventType::SYNCED_META_CHANGE, "syncedMetaChange", [](V8ResourceImpl* resource, const alt::CEvent* e, std::vector<v8::Local<v8::Value>>& args) {
+V8_LOCAL_EVENT_HANDLER syncedMetaChange(EventType::SYNCED_META_CHANGE, "syncedMetaChange", [](V8ResourceImpl* resource, const alt::CEvent* e, V8::EventArgs& args) {
     auto ev = static_cast<const alt::CSyncedMetaDataChangeEvent*>(e);
     v8::Isolate* isolate = resource->GetIsolate();
 
@@ -22,7 +22,7 @@ V8_LOCAL_EVENT_HANDLER syncedMetaChange(EventType::SYNCED_META_CHANGE, "syncedMe
 });
 
 V8_LOCAL_EVENT_HANDLER
-  streamSyncedMetaChange(EventType::STREAM_SYNCED_META_CHANGE, "streamSyncedMetaChange", [](V8ResourceImpl* resource, const alt::CEvent* e, std::vector<v8::Local<v8::Value>>& args) {
+  streamSyncedMetaChange(EventType::STREAM_SYNCED_META_CHANGE, "streamSyncedMetaChange", [](V8ResourceImpl* resource, const alt::CEvent* e, V8::EventArgs& args) {
       auto ev = static_cast<const alt::CStreamSyncedMetaDataChangeEvent*>(e);
       v8::Isolate* isolate = resource->GetIsolate();
 
@@ -33,7 +33,7 @@ V8_LOCAL_EVENT_HANDLER
   });
 
 V8_LOCAL_EVENT_HANDLER
-  globalSyncedMetaChange(EventType::GLOBAL_SYNCED_META_CHANGE, "globalSyncedMetaChange", [](V8ResourceImpl* resource, const alt::CEvent* e, std::vector<v8::Local<v8::Value>>& args) {
+  globalSyncedMetaChange(EventType::GLOBAL_SYNCED_META_CHANGE, "globalSyncedMetaChange", [](V8ResourceImpl* resource, const alt::CEvent* e, V8::EventArgs& args) {
       auto ev = static_cast<const alt::CGlobalSyncedMetaDataChangeEvent*>(e);
       v8::Isolate* isolate = resource->GetIsolate();
 
@@ -42,7 +42,7 @@ V8_LOCAL_EVENT_HANDLER
       args.push_back(V8Helpers::MValueToV8(ev->GetOldVal()));
   });
 
-V8_LOCAL_EVENT_HANDLER globalMetaChange(EventType::GLOBAL_META_CHANGE, "globalMetaChange", [](V8ResourceImpl* resource, const alt::CEvent* e, std::vector<v8::Local<v8::Value>>& args) {
+V8_LOCAL_EVENT_HANDLER globalMetaChange(EventType::GLOBAL_META_CHANGE, "globalMetaChange", [](V8ResourceImpl* resource, const alt::CEvent* e, V8::EventArgs& args) {
     auto ev = static_cast<const alt::CGlobalMetaDataChangeEvent*>(e);
     v8::Isolate* isolate = resource->GetIsolate();
 
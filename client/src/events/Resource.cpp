@@ -10,21 +10,21 @@
 using alt::CEvent;
 using EventType = CEvent::Type;
 
-V8_LOCAL_EVENT_HANDLER anyResourceStart(EventType::RESOURCE_START, "anyResourceStart", [](V8ResourceImpl* resource, const alt::CEvent* e, std::vector<v8::Local<v8::Value>>& args) {
+V8_LOCAL_EVENT_HANDLER anyResourceStart(EventType::RESOURCE_START, "anyResourceStart", [](V8ResourceImpl* resource, const alt::CEvent* e, V8::EventArgs& args) {
     auto ev = static_cast<const alt::CResourceStartEvent*>(e);
     v8::Isolate* isolate = resource->GetIsolate();
 
     args.push_back(V8_NEW_STRING(ev->GetResource()->GetName().CStr()));
 });
 
-V8_LOCAL_EVENT_HANDLER anyResourceStop(EventType::RESOURCE_STOP, "anyResourceStop", [](V8ResourceImpl* resource, const alt::CEvent* e, std::vector<v8::Local<v8::Value>>& args) {
+V8_LOCAL_EVENT_HANDLER anyResourceStop(EventType::RESOURCE_STOP, "anyResourceStop", [](V8ResourceImpl* resource, const alt::CEvent* e, V8::EventArgs& args) {
     auto ev = static_cast<const alt::CResourceStopEvent*>(e);
     v8::Isolate* isolate = resource->GetIsolate();
 
     args.push_back(V8_NEW_STRING(ev->GetResource()->GetName().CStr()));
 });
 
-V8_LOCAL_EVENT_HANDLER anyResourceError(EventType::RESOURCE_ERROR, "anyResourceError", [](V8ResourceImpl* resource, const alt::CEvent* e, std::vector<v8::Local<v8::Value>>& args) {
+V8_LOCAL_EVENT_HANDLER anyResourceError(EventType::RESOURCE_ERROR, "anyResourceError", [](V8ResourceImpl* resource, const alt::CEvent* e, V8::EventArgs& args) {
     auto ev = static_cast<const alt::CResourceErrorEvent*>(e);
     v8::Isolate* isolate = resource->GetIsolate();
 
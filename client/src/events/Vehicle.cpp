@@ -10,7 +10,7 @@
 using alt::CEvent;
 using EventType = CEvent::Type;
 
-V8_LOCAL_EVENT_HANDLER enteredVehicle(EventType::PLAYER_ENTER_VEHICLE, "enteredVehicle", [](V8ResourceImpl* resource, const alt::CEvent* e, std::vector<v8::Local<v8::Value>>& args) {
+V8_LOCAL_EVENT_HANDLER enteredVehicle(EventType::PLAYER_ENTER_VEHICLE, "enteredVehicle", [](V8ResourceImpl* resource, const alt::CEvent* e, V8::EventArgs& args) {
     auto ev = static_cast<const alt::CPlayerEnterVehicleEvent*>(e);
     v8::Isolate* isolate = resource->GetIsolate();
 
@@ -18,7 +18,7 @@ V8_LOCAL_EVENT_HANDLER enteredVehicle(EventType::PLAYER_ENTER_VEHICLE, "enteredV
     args.push_back(V8::JSValue(ev->GetSeat()));
 });
 
-V8_LOCAL_EVENT_HANDLER leftVehicle(EventType::PLAYER_LEAVE_VEHICLE, "leftVehicle", [](V8ResourceImpl* resource, const alt::CEvent* e, std::vector<v8::Local<v8::Value>>& args) {
+V8_LOCAL_EVENT_HANDLER leftVehicle(EventType::PLAYER_LEAVE_VEHICLE, "leftVehicle", [](V8ResourceImpl* resource, const alt::CEvent* e, V8::EventArgs& args) {
     auto ev = static_cast<const alt::CPlayerLeaveVehicleEvent*>(e);
     v8::Isolate* isolate = resource->GetIsolate();
 
@@ -27,7 +27,7 @@ V8_LOCAL_EVENT_HANDLER leftVehicle(EventType::PLAYER_LEAVE_VEHICLE, "leftVehicle
 });
 
 V8_LOCAL_EVENT_HANDLER
-changedVehicleSeat(EventType::PLAYER_CHANGE_VEHICLE_SEAT, "changedVehicleSeat", [](V8ResourceImpl* resource, const alt::CEvent* e, std::vector<v8::Local<v8::Value>>& args) {
+changedVehicleSeat(EventType::PLAYER_CHANGE_VEHICLE_SEAT, "changedVehicleSeat", [](V8ResourceImpl* resource, const alt::CEvent* e, V8::EventArgs& args) {
     auto ev = static_cast<const alt::CPlayerChangeVehicleSeatEvent*>(e);
     v8::Isolate* isolate = resource->GetIsolate();
 
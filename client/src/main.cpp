@@ -24,6 +24,34 @@ static void TimersCommand(alt::Array<alt::StringView>, void* runtime)
     Log::Info << "======================================================" << Log::Endl;
 }
 
+static void EventStatsCommand(alt::Array<alt::StringView> args, void* runtime)
+{
+    std::string_view arg = (args.GetSize() > 0) ? std::string_view{ args[0].GetData(), args[0].GetSize() } : std::string_view{};
+    auto resources = static_cast<CV8ScriptRuntime*>(runtime)->GetResources();
+
+    if(arg == "on" || arg == "off")
+    {
+        V8::EventStats::SetEnabled(arg == "on");
+        Log::Info << "Event stats collection " << (arg == "on" ? "enabled" : "disabled") << Log::Endl;
+    }
+    else if(arg == "reset")
+    {
+        for(auto resource : resources) resource->GetEventStats().Reset();
+        Log::Info << "Event stats reset" << Log::Endl;
+    }
+    else
+    {
+        if(!V8::EventStats::IsEnabled()) Log::Info << "Event stats collection is disabled, use \"eventstats on\" to enable it" << Log::Endl;
+
+        Log::Info << "================ Event stats =================" << Log::Endl;
+        for(auto resource : resources)
+        {
+            resource->DumpEventStats();
+        }
+        Log::Info << "======================================================" << Log::Endl;
+    }
+}
+
 static void ClientJSCommand(alt::Array<alt::StringView> args, void*)
 {
     if(args.GetSize() > 0 && args[0] == "--version")
@@ -40,8 +68,9 @@ static void ClientJSCommand(alt::Array<alt::StringView> args, void*)
         Log::Colored << "~y~Options:" << Log::Endl;
         Log::Colored << "  ~ly~--help    ~w~- this message." << Log::Endl;
         Log::Colored << "  ~ly~--version ~w~- version info." << Log::Endl;
+        V8Helpers::PrintSharedCommandHelp();
     }
-    else
+    else if(!V8Helpers::HandleSharedCommand(args))
     {
         Log::Colored << "~y~Usage: ~w~js-module [options]" << Log::Endl;
         Log::Colored << "  Use: ~ly~\"js-module --help\" ~w~for more info" << Log::Endl;
@@ -57,6 +86,7 @@ ALTV_JS_EXPORT void CreateScriptRuntime(alt::ICore* core)
     // Commands
     core->SubscribeCommand("heap", &HeapCommand, &runtime);
     core->SubscribeCommand("timers", &TimersCommand, &runtime);
+    core->SubscribeCommand("eventstats", &EventStatsCommand, &runtime);
     core->SubscribeCommand("js-module", &ClientJSCommand);
 }
 
@@ -233,6 +233,7 @@ void CWorker::DestroyIsolate()
 {
     while(isolate->IsInUse()) isolate->Exit();
     context.Reset();
+    V8::SourceLocation::DisposeIsolate(isolate);
     isolate->Dispose();
 }
 
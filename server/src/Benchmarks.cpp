@@ -0,0 +1,298 @@
+#include "stdafx.h"
+
+#include <algorithm>
+#include <chrono>
+
+#include "cpp-sdk/events/CServerScriptEvent.h"
+
+#include "Benchmarks.h"
+#include "CNodeScriptRuntime.h"
+#include "V8Module.h"
+
+extern V8Module v8Alt;
+
+using Clock = std::chrono::steady_clock;
+
+static constexpr const char* BenchEvent = "js-module:bench";
+
+static double ElapsedNs(Clock::time_point since)
+{
+    return std::chrono::duration<double, std::nano>(Clock::now() - since).count();
+}
+
+// The JS benchmarks run in the first started resource
+static CNodeResourceImpl* GetBenchResource(CNodeScriptRuntime* runtime)
+{
+    v8::Isolate* isolate = runtime->GetIsolate();
+    v8::Locker locker(isolate);
+    v8::Isolate::Scope isolateScope(isolate);
+    v8::HandleScope handleScope(isolate);
+
+    for(auto resource : runtime->GetResources())
+    {
+        if(!resource->GetContext().IsEmpty()) return resource;
+    }
+
+    return nullptr;
+}
+
+// Calls source as function(alt, n) in the context of the resource, has to be called inside of its scopes
+static v8::MaybeLocal<v8::Value> CallSource(CNodeResourceImpl* resource, const char* source, uint32_t count)
+{
+    v8::Isolate* isolate = resource->GetIsolate();
+    v8::Local<v8::Context> ctx = resource->GetContext();
+
+    v8::ScriptOrigin origin(V8_NEW_STRING("js-module:bench"));
+    v8::ScriptCompiler::Source src(V8_NEW_STRING(source), origin);
+    v8::Local<v8::String> params[] = { V8_NEW_STRING("alt"), V8_NEW_STRING("n") };
+
+    v8::Local<v8::Function> fn;
+    if(!v8::ScriptCompiler::CompileFunctionInContext(ctx, &src, 2, params, 0, nullptr).ToLocal(&fn)) return {};
+
+    v8::Local<v8::Value> args[] = { v8Alt.GetExports(isolate, ctx), v8::Integer::NewFromUnsigned(isolate, count) };
+    return fn->Call(ctx, v8::Undefined(isolate), 2, args);
+}
+
+// The source returns an object of cases, functions returning how many operations they did.
+// Each case runs once to warm up and once timed, a "dispose" function is called at the end
+static void RunCases(CNodeResourceImpl* resource, const char* name, const char* source, uint32_t count)
+{
+    v8::Isolate* isolate = resource->GetIsolate();
+    v8::Locker locker(isolate);
+    v8::Isolate::Scope isolateScope(isolate);
+    v8::HandleScope handleScope(isolate);
+
+    v8::Local<v8::Context> ctx = resource->GetContext();
+    v8::Context::Scope scope(ctx);
+
+    V8Helpers::TryCatch([&] {
+        v8::Local<v8::Value> result;
+        if(!CallSource(resource, source, count).ToLocal(&result) || !result->IsObject()) return false;
+
+        v8::Local<v8::Object> cases = result.As<v8::Object>();
+        v8::Local<v8::Array> names = cases->GetOwnPropertyNames(ctx).ToLocalChecked();
+        v8::Local<v8::Value> dispose;
+
+        for(uint32_t i = 0; i < names->Length(); ++i)
+        {
+            v8::Local<v8::Value> caseName = names->Get(ctx, i).ToLocalChecked();
+            v8::Local<v8::Value> fn = cases->Get(ctx, caseName).ToLocalChecked();
+            if(!fn->IsFunction()) continue;
+
+            std::string caseStr = *v8::String::Utf8Value(isolate, caseName);
+            if(caseStr == "dispose")
+            {
+                dispose = fn;
+                continue;
+            }
+
+            v8::Local<v8::Value> ops;
+            if(!fn.As<v8::Function>()->Call(ctx, cases, 0, nullptr).ToLocal(&ops)) return false;
+
+            auto begin = Clock::now();
+            if(!fn.As<v8::Function>()->Call(ctx, cases, 0, nullptr).ToLocal(&ops)) return false;
+            double ns = ElapsedNs(begin);
+
+            double opCount = ops->IsNumber() ? std::max(1.0, ops.As<v8::Number>()->Value()) : 1.0;
+            Log::Info << name << " " << caseStr << ": " << ns / opCount << " ns per op (" << opCount << " ops in " << ns / 1e6 << "ms)" << Log::Endl;
+        }
+
+        if(!dispose.IsEmpty() && dispose.As<v8::Function>()->Call(ctx, cases, 0, nullptr).IsEmpty()) return false;
+        return true;
+    });
+}
+
+// About 2 KB of nested lists, vectors and strings
+static alt::MValueArgs CreateEventArgs()
+{
+    alt::ICore& core = alt::ICore::Instance();
+
+    alt::MValueDict dict = core.CreateMValueDict();
+    for(int i = 0; i < 32; ++i)
+    {
+        alt::MValueList list = core.CreateMValueList(3);
+        list->Set(0, core.CreateMValueVector3(alt::Vector3f{ float(i), float(i * 2), float(i * 3) }));
+        list->Set(1, core.CreateMValueString(("payload entry " + std::to_string(i)).c_str()));
+        list->Set(2, core.CreateMValueDouble(i * 0.5));
+        dict->Set(("key" + std::to_string(i)).c_str(), list);
+    }
+
+    alt::MValueArgs args;
+    args.Push(dict);
+    return args;
+}
+
+// One event is delivered to every resource like the core does, each with a native handler, so only
+// the dispatch and argument conversion are measured. The args cache is cleared like at the end of a tick
+static void EventsBenchmark(CNodeScriptRuntime* runtime, uint32_t count)
+{
+    v8::Isolate* isolate = runtime->GetIsolate();
+    v8::Locker locker(isolate);
+    v8::Isolate::Scope isolateScope(isolate);
+    v8::HandleScope handleScope(isolate);
+
+    std::vector<std::pair<CNodeResourceImpl*, v8::Global<v8::Function>>> handlers;
+    for(auto resource : runtime->GetResources())
+    {
+        v8::Local<v8::Context> ctx = resource->GetContext();
+        if(ctx.IsEmpty()) continue;
+
+        v8::Local<v8::Function> fn = v8::Function::New(ctx, [](const v8::FunctionCallbackInfo<v8::Value>&) {}).ToLocalChecked();
+        resource->SubscribeLocal(BenchEvent, fn, V8::SourceLocation{ nullptr, V8::SourceLocation::UnknownScript, 0, resource->GetResource() });
+        handlers.emplace_back(resource, v8::Global<v8::Function>(isolate, fn));
+    }
+
+    if(handlers.empty())
+    {
+        Log::Info << "events: no started resources" << Log::Endl;
+        return;
+    }
+
+    alt::CServerScriptEvent event(BenchEvent, CreateEventArgs());
+
+    auto begin = Clock::now();
+    for(uint32_t i = 0; i < count; ++i)
+    {
+        for(auto& [resource, fn] : handlers) resource->OnEvent(&event);
+        runtime->GetArgsCache().Clear();
+    }
+    double ns = ElapsedNs(begin);
+
+    for(auto& [resource, fn] : handlers) resource->UnsubscribeLocal(BenchEvent, fn.Get(isolate));
+
+    Log::Info << "events: " << ns / count << " ns per event, " << ns / (double(count) * handlers.size()) << " ns per resource (" << count << " events to " << handlers.size()
+              << " resources)" << Log::Endl;
+}
+
+static const char mvaluePayload[] = R"(
+const items = [];
+for(let i = 0; i < 16; ++i) items.push({ id: i, name: 'item' + i, pos: new alt.Vector3(i, i * 2, i * 3), tags: ['a', 'b', 'c'] });
+return { name: 'payload', color: new alt.RGBA(255, 128, 0, 255), pos: new alt.Vector3(1, 2, 3), items };
+)";
+
+static void MValueBenchmark(CNodeScriptRuntime* runtime, uint32_t count)
+{
+    CNodeResourceImpl* resource = GetBenchResource(runtime);
+    if(!resource)
+    {
+        Log::Info << "mvalue: no started resources" << Log::Endl;
+        return;
+    }
+
+    v8::Isolate* isolate = resource->GetIsolate();
+    v8::Locker locker(isolate);
+    v8::Isolate::Scope isolateScope(isolate);
+    v8::HandleScope handleScope(isolate);
+
+    v8::Context::Scope scope(resource->GetContext());
+
+    V8Helpers::TryCatch([&] {
+        v8::Local<v8::Value> payload;
+        if(!CallSource(resource, mvaluePayload, count).ToLocal(&payload)) return false;
+
+        auto begin = Clock::now();
+        for(uint32_t i = 0; i < count; ++i)
+        {
+            v8::HandleScope iterationScope(isolate);
+            V8Helpers::V8ToMValue(payload);
+        }
+        double ns = ElapsedNs(begin);
+
+        Log::Info << "mvalue: " << ns / count << " ns per conversion of a nested object (" << count << " conversions)" << Log::Endl;
+        return true;
+    });
+}
+
+static const char vectorsSource[] = R"(
+const points = new Float32Array(n * 3);
+for(let i = 0; i < points.length; ++i) points[i] = Math.random() * 8000 - 4000;
+const vectors = [];
+for(let i = 0; i < n; ++i) vectors.push(new alt.Vector3(points[i * 3], points[i * 3 + 1], points[i * 3 + 2]));
+const out = new Float32Array(n);
+const origin = new alt.Vector3(10, 20, 30);
+return {
+    distanceTo() { let sum = 0; for(let i = 0; i < n; ++i) sum += origin.distanceTo(vectors[i]); return n; },
+    isInRange() { let hits = 0; for(let i = 0; i < n; ++i) if(origin.isInRange(vectors[i], 500)) ++hits; return n; },
+    distancesTo() { alt.Vector3.distancesTo(origin, points, out); return n; },
+};
+)";
+
+static const char accessorsSource[] = R"(
+const vehicle = new alt.Vehicle('adder', 0, 0, 72, 0, 0, 0);
+return {
+    id() { let sum = 0; for(let i = 0; i < n; ++i) sum += vehicle.id; return n; },
+    dimension() { let sum = 0; for(let i = 0; i < n; ++i) sum += vehicle.dimension; return n; },
+    engineHealth() { let sum = 0; for(let i = 0; i < n; ++i) sum += vehicle.engineHealth; return n; },
+    dispose() { vehicle.destroy(); },
+};
+)";
+
+static const char spatialSource[] = R"(
+const vehicles = [];
+for(let i = 0; i < n; ++i) vehicles.push(new alt.Vehicle('adder', Math.random() * 8000 - 4000, Math.random() * 8000 - 4000, 72, 0, 0, 0));
+const queries = 1000, range = 150;
+const centers = [];
+for(let i = 0; i < queries; ++i) centers.push(new alt.Vector3(Math.random() * 8000 - 4000, Math.random() * 8000 - 4000, 72));
+return {
+    getEntitiesInRange() { for(const pos of centers) alt.getEntitiesInRange(pos, range, 0); return queries; },
+    scan() {
+        for(const pos of centers) {
+            const found = [];
+            for(const vehicle of alt.Vehicle.all) {
+                if(vehicle.dimension === 0 && vehicle.pos.distanceTo(pos) <= range) found.push(vehicle);
+            }
+        }
+        return queries;
+    },
+    dispose() { for(const vehicle of vehicles) vehicle.destroy(); },
+};
+)";
+
+struct Benchmark
+{
+    const char* name;
+    const char* description;
+    uint32_t defaultCount;
+    void (*run)(CNodeScriptRuntime* runtime, const Benchmark& bench, uint32_t count);
+    const char* source;
+};
+
+static void RunSource(CNodeScriptRuntime* runtime, const Benchmark& bench, uint32_t count)
+{
+    CNodeResourceImpl* resource = GetBenchResource(runtime);
+    if(!resource)
+    {
+        Log::Info << bench.name << ": no started resources" << Log::Endl;
+        return;
+    }
+
+    RunCases(resource, bench.name, bench.source, count);
+}
+
+static const Benchmark benchmarks[] = {
+    { "events", "count server events with a 2 KB dict delivered to every resource", 100000, [](CNodeScriptRuntime* runtime, const Benchmark&, uint32_t count) { EventsBenchmark(runtime, count); }, nullptr },
+    { "mvalue", "count conversions of a nested object with vectors to MValue", 100000, [](CNodeScriptRuntime* runtime, const Benchmark&, uint32_t count) { MValueBenchmark(runtime, count); }, nullptr },
+    { "vectors", "Vector3 distanceTo/isInRange against Vector3.distancesTo over count points", 100000, RunSource, vectorsSource },
+    { "accessors", "count reads of vehicle accessors", 10000000, RunSource, accessorsSource },
+    { "spatial", "1000 range queries over count vehicles, native grid against a scan of Vehicle.all", 1000, RunSource, spatialSource },
+};
+
+bool Benchmarks::Run(CNodeScriptRuntime* runtime, std::string_view name, uint32_t count)
+{
+    for(auto& bench : benchmarks)
+    {
+        if(name != bench.name) continue;
+
+        bench.run(runtime, bench, count != 0 ? count : bench.defaultCount);
+        return true;
+    }
+
+    return false;
+}
+
+void Benchmarks::PrintHelp()
+{
+    Log::Colored << "~y~Usage: ~w~bench <name> [count]" << Log::Endl;
+    for(auto& bench : benchmarks) Log::Colored << "  ~ly~" << bench.name << " ~w~- " << bench.description << " (count " << bench.defaultCount << ")." << Log::Endl;
+    Log::Colored << "~y~The idle tick cost of the resources is shown by ~ly~loops ~w~while ~ly~eventstats on~w~." << Log::Endl;
+}
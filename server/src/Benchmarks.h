@@ -0,0 +1,15 @@
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+
+class CNodeScriptRuntime;
+
+// Microbenchmarks of the hot paths, run by the "bench" command against the live isolate and core.
+// The numbers are only comparable between builds on the same machine
+namespace Benchmarks
+{
+    // count 0 uses the default of the benchmark
+    bool Run(CNodeScriptRuntime* runtime, std::string_view name, uint32_t count);
+    void PrintHelp();
+}  // namespace Benchmarks
@@ -0,0 +1,79 @@
+#include "stdafx.h"
+
+#ifdef __linux__
+    #include <unistd.h>
+#endif
+
+#include "CLoopPoller.h"
+#include "CNodeResourceImpl.h"
+
+CLoopPoller::CLoopPoller()
+{
+#ifdef __linux__
+    epollFd = epoll_create1(EPOLL_CLOEXEC);
+#endif
+}
+
+CLoopPoller::~CLoopPoller()
+{
+#ifdef __linux__
+    if(epollFd != -1) close(epollFd);
+#endif
+}
+
+bool CLoopPoller::Add(CNodeResourceImpl* resource, uv_loop_t* loop)
+{
+#ifdef __linux__
+    int fd = uv_backend_fd(loop);
+    if(epollFd == -1 || fd == -1) return false;
+
+    epoll_event ev{};
+    ev.events = EPOLLIN;
+    ev.data.ptr = resource;
+    if(epoll_ctl(epollFd, EPOLL_CTL_ADD, fd, &ev) != 0) return false;
+
+    ++count;
+    events.resize(count);
+    return true;
+#else
+    return false;
+#endif
+}
+
+void CLoopPoller::Remove(uv_loop_t* loop)
+{
+#ifdef __linux__
+    int fd = uv_backend_fd(loop);
+    if(epollFd == -1 || fd == -1) return;
+
+    epoll_event ev{};
+    if(epoll_ctl(epollFd, EPOLL_CTL_DEL, fd, &ev) == 0) --count;
+#endif
+}
+
+void CLoopPoller::Poll()
+{
+    if(polled) return;
+    polled = true;
+
+#ifdef __linux__
+    if(count == 0) return;
+
+    // Sized for every loop, so one call reports all of them
+    int readyCount = epoll_wait(epollFd, events.data(), int(count), 0);
+    for(int i = 0; i < readyCount; ++i) static_cast<CNodeResourceImpl*>(events[i].data.ptr)->SetLoopReady();
+#endif
+}
+
+bool CLoopPoller::HasDueWork(uv_loop_t* loop)
+{
+#ifdef __linux__
+    // Watchers started since the last run are only added to the backend fd by uv_run
+    if(loop->watcher_queue[0] != static_cast<void*>(loop->watcher_queue)) return true;
+
+    uv_update_time(loop);
+    return uv_backend_timeout(loop) == 0;
+#else
+    return true;
+#endif
+}
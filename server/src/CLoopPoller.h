@@ -0,0 +1,62 @@
+#pragma once
+
+#include <vector>
+
+#include "uv.h"
+
+#ifdef __linux__
+    #include <sys/epoll.h>
+#endif
+
+class CNodeResourceImpl;
+
+// Tells which resource loops have work, so idle resources aren't entered every tick.
+// On Linux the backend fd of every loop is watched by one shared epoll set, which is polled
+// once per tick. Other backends can't be watched, there every live loop counts as ready
+class CLoopPoller
+{
+public:
+    CLoopPoller();
+    ~CLoopPoller();
+
+    CLoopPoller(const CLoopPoller&) = delete;
+
+    static bool IsEnabled()
+    {
+        return Enabled();
+    }
+
+    static void SetEnabled(bool enabled)
+    {
+        Enabled() = enabled;
+    }
+
+    // Returns false if the loop can't be watched
+    bool Add(CNodeResourceImpl* resource, uv_loop_t* loop);
+    void Remove(uv_loop_t* loop);
+
+    void NextTick()
+    {
+        polled = false;
+    }
+
+    // Marks the resources with ready I/O, only polls once per tick
+    void Poll();
+
+    // Timers, idle handles and callbacks of a loop that are due without any I/O
+    static bool HasDueWork(uv_loop_t* loop);
+
+private:
+    int epollFd = -1;
+#ifdef __linux__
+    std::vector<epoll_event> events;
+#endif
+    size_t count = 0;
+    bool polled = false;
+
+    static bool& Enabled()
+    {
+        static bool _enabled = false;
+        return _enabled;
+    }
+};
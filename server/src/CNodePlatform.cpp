@@ -0,0 +1,125 @@
+#include "stdafx.h"
+
+#include "CNodePlatform.h"
+
+// Counted as queued from its creation until it ran or was dropped
+class CNodePlatform::CountedTask : public v8::Task
+{
+public:
+    CountedTask(std::unique_ptr<v8::Task> _task, std::shared_ptr<Counters> _counters, bool _delayed) : task(std::move(_task)), counters(std::move(_counters)), delayed(_delayed)
+    {
+        ++Queued();
+    }
+
+    ~CountedTask() override
+    {
+        if(!ran) --Queued();
+    }
+
+    void Run() override
+    {
+        ran = true;
+        --Queued();
+        task->Run();
+    }
+
+private:
+    std::unique_ptr<v8::Task> task;
+    std::shared_ptr<Counters> counters;
+    bool delayed;
+    bool ran = false;
+
+    std::atomic<int64_t>& Queued()
+    {
+        return delayed ? counters->delayedTasks : counters->tasks;
+    }
+};
+
+class CNodePlatform::CountingTaskRunner : public v8::TaskRunner
+{
+public:
+    CountingTaskRunner(std::shared_ptr<v8::TaskRunner> _runner) : runner(std::move(_runner)) {}
+
+    std::shared_ptr<Counters> counters = std::make_shared<Counters>();
+
+    void PostTask(std::unique_ptr<v8::Task> task) override
+    {
+        runner->PostTask(std::make_unique<CountedTask>(std::move(task), counters, false));
+    }
+    void PostNonNestableTask(std::unique_ptr<v8::Task> task) override
+    {
+        runner->PostNonNestableTask(std::make_unique<CountedTask>(std::move(task), counters, false));
+    }
+    void PostDelayedTask(std::unique_ptr<v8::Task> task, double delayInSeconds) override
+    {
+        runner->PostDelayedTask(std::make_unique<CountedTask>(std::move(task), counters, true), delayInSeconds);
+    }
+    void PostNonNestableDelayedTask(std::unique_ptr<v8::Task> task, double delayInSeconds) override
+    {
+        runner->PostNonNestableDelayedTask(std::make_unique<CountedTask>(std::move(task), counters, true), delayInSeconds);
+    }
+    void PostIdleTask(std::unique_ptr<v8::IdleTask> task) override
+    {
+        runner->PostIdleTask(std::move(task));
+    }
+    bool IdleTasksEnabled() override
+    {
+        return runner->IdleTasksEnabled();
+    }
+    bool NonNestableTasksEnabled() const override
+    {
+        return runner->NonNestableTasksEnabled();
+    }
+    bool NonNestableDelayedTasksEnabled() const override
+    {
+        return runner->NonNestableDelayedTasksEnabled();
+    }
+
+private:
+    std::shared_ptr<v8::TaskRunner> runner;
+};
+
+CNodePlatform::CNodePlatform(int threadPoolSize, v8::TracingController* tracingController)
+    : platform(node::CreatePlatform(threadPoolSize, tracingController))
+{
+}
+
+CNodePlatform::QueueDepth CNodePlatform::GetForegroundQueueDepth(v8::Isolate* isolate)
+{
+    std::lock_guard<std::mutex> lock(runnersMutex);
+
+    auto it = runners.find(isolate);
+    if(it == runners.end()) return {};
+
+    return { it->second->counters->tasks, it->second->counters->delayedTasks };
+}
+
+void CNodePlatform::UnregisterIsolate(v8::Isolate* isolate)
+{
+    {
+        std::lock_guard<std::mutex> lock(runnersMutex);
+        runners.erase(isolate);
+    }
+
+    platform->UnregisterIsolate(isolate);
+}
+
+std::shared_ptr<v8::TaskRunner> CNodePlatform::GetForegroundTaskRunner(v8::Isolate* isolate)
+{
+    std::lock_guard<std::mutex> lock(runnersMutex);
+
+    auto it = runners.find(isolate);
+    if(it == runners.end()) it = runners.emplace(isolate, std::make_shared<CountingTaskRunner>(platform->GetForegroundTaskRunner(isolate))).first;
+
+    return it->second;
+}
+
+void CNodePlatform::CallOnWorkerThread(std::unique_ptr<v8::Task> task)
+{
+    platform->CallOnWorkerThread(std::make_unique<CountedTask>(std::move(task), workerQueue, false));
+}
+
+void CNodePlatform::CallDelayedOnWorkerThread(std::unique_ptr<v8::Task> task, double delayInSeconds)
+{
+    platform->CallDelayedOnWorkerThread(std::make_unique<CountedTask>(std::move(task), workerQueue, true), delayInSeconds);
+}
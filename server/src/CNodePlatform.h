@@ -0,0 +1,104 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include "node.h"
+#include "uv.h"
+
+// Forwards to the node platform and counts the tasks that are queued but didn't run yet,
+// per isolate for the foreground and for the shared worker pool
+class CNodePlatform : public node::MultiIsolatePlatform
+{
+public:
+    struct QueueDepth
+    {
+        int64_t tasks = 0;
+        int64_t delayedTasks = 0;
+    };
+
+    CNodePlatform(int threadPoolSize, v8::TracingController* tracingController);
+
+    QueueDepth GetWorkerQueueDepth() const
+    {
+        return { workerQueue->tasks, workerQueue->delayedTasks };
+    }
+
+    QueueDepth GetForegroundQueueDepth(v8::Isolate* isolate);
+
+    // node::MultiIsolatePlatform
+    bool FlushForegroundTasks(v8::Isolate* isolate) override
+    {
+        return platform->FlushForegroundTasks(isolate);
+    }
+    void DrainTasks(v8::Isolate* isolate) override
+    {
+        platform->DrainTasks(isolate);
+    }
+    void CancelPendingDelayedTasks(v8::Isolate* isolate) override
+    {
+        platform->CancelPendingDelayedTasks(isolate);
+    }
+    void RegisterIsolate(v8::Isolate* isolate, uv_loop_t* loop) override
+    {
+        platform->RegisterIsolate(isolate, loop);
+    }
+    void RegisterIsolate(v8::Isolate* isolate, node::IsolatePlatformDelegate* delegate) override
+    {
+        platform->RegisterIsolate(isolate, delegate);
+    }
+    void UnregisterIsolate(v8::Isolate* isolate) override;
+    void AddIsolateFinishedCallback(v8::Isolate* isolate, void (*callback)(void*), void* data) override
+    {
+        platform->AddIsolateFinishedCallback(isolate, callback, data);
+    }
+
+    // v8::Platform
+    int NumberOfWorkerThreads() override
+    {
+        return platform->NumberOfWorkerThreads();
+    }
+    std::shared_ptr<v8::TaskRunner> GetForegroundTaskRunner(v8::Isolate* isolate) override;
+    void CallOnWorkerThread(std::unique_ptr<v8::Task> task) override;
+    void CallDelayedOnWorkerThread(std::unique_ptr<v8::Task> task, double delayInSeconds) override;
+    bool IdleTasksEnabled(v8::Isolate* isolate) override
+    {
+        return platform->IdleTasksEnabled(isolate);
+    }
+    double MonotonicallyIncreasingTime() override
+    {
+        return platform->MonotonicallyIncreasingTime();
+    }
+    double CurrentClockTimeMillis() override
+    {
+        return platform->CurrentClockTimeMillis();
+    }
+    v8::TracingController* GetTracingController() override
+    {
+        return platform->GetTracingController();
+    }
+    StackTracePrinter GetStackTracePrinter() override
+    {
+        return platform->GetStackTracePrinter();
+    }
+
+private:
+    // Shared with the tasks, which can outlive the runner of an unregistered isolate
+    struct Counters
+    {
+        std::atomic<int64_t> tasks{ 0 };
+        std::atomic<int64_t> delayedTasks{ 0 };
+    };
+
+    class CountedTask;
+    class CountingTaskRunner;
+
+    std::unique_ptr<node::MultiIsolatePlatform> platform;
+    std::shared_ptr<Counters> workerQueue = std::make_shared<Counters>();
+
+    // Task runners are requested from background threads too
+    std::mutex runnersMutex;
+    std::unordered_map<v8::Isolate*, std::shared_ptr<CountingTaskRunner>> runners;
+};
@@ -5,30 +5,43 @@
 #include "V8Module.h"
 #include "V8Helpers.h"
 
+#include "env-inl.h"
+
 static void ResourceLoaded(const v8::FunctionCallbackInfo<v8::Value>& info)
 {
     V8_GET_ISOLATE_CONTEXT();
-    V8_CHECK_ARGS_LEN(2);
+    V8_CHECK_ARGS_LEN(4);
 
     V8_ARG_TO_STRING(1, name);
+    V8_ARG_TO_NUMBER(3, importTime);
+    V8_ARG_TO_NUMBER(4, startTime);
 
     alt::IResource* resource = alt::ICore::Instance().GetResource(name);
     if(resource && resource->GetType() == "js")
     {
         CNodeResourceImpl* _resource = static_cast<CNodeResourceImpl*>(resource->GetImpl());
-        _resource->Started(info[1]);
+        _resource->Started(info[1], importTime, startTime);
     }
 }
 
+// Body of a function taking process and the internal require
 static const char bootstrap_code[] = R"(
 'use strict';
 
 (async () => {
   const alt = process._linkedBinding('alt');
+
+  console.log = alt.log;
+  console.warn = alt.logWarning;
+  console.error = alt.logError;
+
   const path = require('path');
   const asyncESM = require('internal/process/esm_loader');
   const { pathToFileURL } = require('internal/url');
+  const { performance } = require('perf_hooks');
   let _exports = null;
+  let importTime = 0;
+  let startTime = 0;
 
   try {
     const loader = asyncESM.ESMLoader;
@@ -49,25 +62,82 @@ static const char bootstrap_code[] = R"(
     });
     const _path = path.resolve(alt.getResourcePath(alt.resourceName), alt.getResourceMain(alt.resourceName));
 
+    let time = performance.now();
     _exports = await loader.import(pathToFileURL(_path).pathname);
+    importTime = performance.now() - time;
 
     if ('start' in _exports) {
       const start = _exports.start;
       if (typeof start === 'function') {
+        time = performance.now();
         await start();
+        startTime = performance.now() - time;
       }
     }
   } catch (e) {
     console.error(e);
   }
 
-  __resourceLoaded(alt.resourceName, _exports);
+  __resourceLoaded(alt.resourceName, _exports, importTime, startTime);
 })();
 )";
 
-extern V8Module sharedModule;
+static double ElapsedMs(std::chrono::steady_clock::time_point& since)
+{
+    auto now = std::chrono::steady_clock::now();
+    double ms = std::chrono::duration<double, std::milli>(now - since).count();
+    since = now;
+    return ms;
+}
+
+// The bootstrap is the same for every resource, so only the first one compiles it
+// and the ones after consume its code cache
+static v8::MaybeLocal<v8::Value> RunBootstrap(CNodeScriptRuntime* runtime, const node::StartExecutionCallbackInfo& info)
+{
+    v8::Isolate* isolate = v8::Isolate::GetCurrent();
+    v8::Local<v8::Context> ctx = isolate->GetCurrentContext();
+
+    auto compileBegin = std::chrono::steady_clock::now();
+
+    CNodeScriptRuntime::BootstrapCache& cache = runtime->GetBootstrapCache();
+    v8::ScriptCompiler::CachedData* cachedData = cache.data.empty() ? nullptr : new v8::ScriptCompiler::CachedData(cache.data.data(), int(cache.data.size()));
+
+    v8::ScriptOrigin origin(V8_NEW_STRING("alt:bootstrap"));
+    v8::ScriptCompiler::Source source(V8_NEW_STRING(bootstrap_code), origin, cachedData);
+    v8::Local<v8::String> params[] = { V8_NEW_STRING("process"), V8_NEW_STRING("require") };
+
+    auto options = cachedData ? v8::ScriptCompiler::kConsumeCodeCache : v8::ScriptCompiler::kNoCompileOptions;
+    v8::Local<v8::Function> fn;
+    if(!v8::ScriptCompiler::CompileFunctionInContext(ctx, &source, 2, params, 0, nullptr, options).ToLocal(&fn)) return {};
+
+    const char* cacheState = cachedData ? "consumed" : "none";
+    if(cachedData && cachedData->rejected)
+    {
+        cacheState = "rejected";
+        cache.data.clear();
+        cache.rejected = true;
+    }
+
+    Log::Info << "[V8] Bootstrap compiled in " << ElapsedMs(compileBegin) << "ms (code cache " << cacheState << ")" << Log::Endl;
+
+    v8::Local<v8::Value> args[] = { info.process_object, info.native_require };
+    v8::MaybeLocal<v8::Value> result = fn->Call(ctx, v8::Undefined(isolate), 2, args);
+
+    // Created after the call, so the cache also holds the lazily compiled inner functions
+    if(cache.data.empty() && !cache.rejected)
+    {
+        std::unique_ptr<v8::ScriptCompiler::CachedData> created(v8::ScriptCompiler::CreateCodeCacheForFunction(fn));
+        if(created) cache.data.assign(created->data, created->data + created->length);
+    }
+
+    return result;
+}
+
 bool CNodeResourceImpl::Start()
 {
+    auto startBegin = std::chrono::steady_clock::now();
+    auto phaseBegin = startBegin;
+
     v8::Locker locker(isolate);
     v8::Isolate::Scope isolateScope(isolate);
     v8::HandleScope handleScope(isolate);
@@ -86,9 +156,12 @@ bool CNodeResourceImpl::Start()
 
     V8ResourceImpl::Start();
 
+    double contextTime = ElapsedMs(phaseBegin);
+
     node::EnvironmentFlags::Flags flags = (node::EnvironmentFlags::Flags)(node::EnvironmentFlags::kOwnsProcessState & node::EnvironmentFlags::kNoInitializeInspector);
 
     uvLoop = uv_loop_new();
+    loopWatched = runtime->GetLoopPoller().Add(this, uvLoop);
 
     nodeData = node::CreateIsolateData(isolate, uvLoop, runtime->GetPlatform());
     std::vector<std::string> argv = { "altv-resource" };
@@ -97,28 +170,39 @@ bool CNodeResourceImpl::Start()
     node::IsolateSettings is;
     node::SetIsolateUpForNode(isolate, is);
 
-    node::LoadEnvironment(env, bootstrap_code);
+    double environmentTime = ElapsedMs(phaseBegin);
 
-    auto exports = sharedModule.GetExports(isolate, _context);
+    node::LoadEnvironment(env, [this](const node::StartExecutionCallbackInfo& info) { return RunBootstrap(runtime, info); });
 
-    // Overwrite global console object
-    auto console = _context->Global()->Get(_context, V8_NEW_STRING("console")).ToLocalChecked().As<v8::Object>();
-    if(!console.IsEmpty())
-    {
-        console->Set(_context, V8_NEW_STRING("log"), exports->Get(_context, V8_NEW_STRING("log")).ToLocalChecked());
-        console->Set(_context, V8_NEW_STRING("warn"), exports->Get(_context, V8_NEW_STRING("logWarning")).ToLocalChecked());
-        console->Set(_context, V8_NEW_STRING("error"), exports->Get(_context, V8_NEW_STRING("logError")).ToLocalChecked());
-    }
+    double loadTime = ElapsedMs(phaseBegin);
 
     asyncResource.Reset(isolate, v8::Object::New(isolate));
     asyncContext = node::EmitAsyncInit(isolate, asyncResource.Get(isolate), "CNodeResourceImpl");
 
-    while(!envStarted && !startError)
+    // The bootstrap finishes asynchronously, instead of spinning until it did, block on the
+    // resource loop. The timer wakes it up to drain the platform tasks and run the alt timers
+    uv_timer_t wakeup;
+    uv_timer_init(uvLoop, &wakeup);
+    uv_timer_start(&wakeup, [](uv_timer_t*) {}, StartWakeupInterval, StartWakeupInterval);
+
+    while(true)
     {
         runtime->OnTick();
         OnTick();
+
+        if(envStarted || startError) break;
+
+        node::CallbackScope callbackScope(isolate, asyncResource.Get(isolate), asyncContext);
+        uv_run(uvLoop, UV_RUN_ONCE);
     }
 
+    // The handle lives on the stack, let the loop finish closing it
+    uv_close((uv_handle_t*)&wakeup, nullptr);
+    uv_run(uvLoop, UV_RUN_NOWAIT);
+
+    Log::Info << "[V8] Resource " << resource->GetName() << (startError ? " failed to start after " : " started in ") << ElapsedMs(startBegin) << "ms (context " << contextTime
+              << "ms, CreateEnvironment " << environmentTime << "ms, LoadEnvironment " << loadTime << "ms, import " << importTime << "ms, start() " << startFnTime << "ms)" << Log::Endl;
+
     DispatchStartEvent(startError);
 
     return !startError;
@@ -149,11 +233,18 @@ bool CNodeResourceImpl::Stop()
     node::FreeEnvironment(env);
     node::FreeIsolateData(nodeData);
 
+    if(loopWatched) runtime->GetLoopPoller().Remove(uvLoop);
+
+    scriptNames.Clear();
+
     return true;
 }
 
-void CNodeResourceImpl::Started(v8::Local<v8::Value> _exports)
+void CNodeResourceImpl::Started(v8::Local<v8::Value> _exports, double _importTime, double _startTime)
 {
+    importTime = _importTime;
+    startFnTime = _startTime;
+
     if(!_exports->IsNullOrUndefined())
     {
         alt::MValueDict exports = V8Helpers::V8ToMValue(_exports).As<alt::IMValueDict>();
@@ -178,41 +269,64 @@ bool CNodeResourceImpl::OnEvent(const alt::CEvent* e)
     V8::EventHandler* handler = V8::EventHandler::Get(e);
     if(!handler) return true;
 
-    // Generic event handler
+    auto evType = e->GetType();
+    bool isScriptEvent = evType == alt::CEvent::Type::CLIENT_SCRIPT_EVENT || evType == alt::CEvent::Type::SERVER_SCRIPT_EVENT;
+    bool local = evType == alt::CEvent::Type::SERVER_SCRIPT_EVENT;
+
+    const std::vector<V8::EventCallback*>& genericCallbacks = isScriptEvent ? GetGenericHandlers(local) : V8::EventHandlerTable::Empty();
+    const std::vector<V8::EventCallback*>& callbacks = handler->GetCallbacks(this, e);
+
+    // Arguments are only materialized when a live callback is going to receive them
+    bool hasGeneric = V8::EventHandlerTable::HasLive(genericCallbacks);
+    bool hasSpecific = V8::EventHandlerTable::HasLive(callbacks);
+
+    if(!hasGeneric && !hasSpecific)
     {
-        auto evType = e->GetType();
-        if(evType == alt::CEvent::Type::CLIENT_SCRIPT_EVENT || evType == alt::CEvent::Type::SERVER_SCRIPT_EVENT)
-        {
-            std::vector<V8::EventCallback*> callbacks;
-            const char* eventName;
+        // Only counted when there were handlers, all of them removed since
+        if(!genericCallbacks.empty() || !callbacks.empty()) ++eventArgsSkipped;
+        return true;
+    }
 
-            if(evType == alt::CEvent::Type::SERVER_SCRIPT_EVENT)
-            {
-                callbacks = std::move(GetGenericHandlers(true));
-                eventName = static_cast<const alt::CServerScriptEvent*>(e)->GetName().CStr();
-            }
-            else if(evType == alt::CEvent::Type::CLIENT_SCRIPT_EVENT)
-            {
-                callbacks = std::move(GetGenericHandlers(false));
-                eventName = static_cast<const alt::CClientScriptEvent*>(e)->GetName().CStr();
-            }
+    // Generic handlers receive the event name as first argument, the arguments are converted once
+    // with the name in front and shifted away for the specific handlers. Changes made by generic handlers
+    // must not be visible to the specific ones, so they get their own objects created from the args cache
+    V8::EventArgs args(eventArgs);
+
+    if(hasGeneric)
+    {
+        const char* eventName;
+
+        if(local) eventName = static_cast<const alt::CServerScriptEvent*>(e)->GetName().CStr();
+        else
+            eventName = static_cast<const alt::CClientScriptEvent*>(e)->GetName().CStr();
+
+        args.push_back(V8_NEW_STRING(eventName));
+        handler->GetArgs(this, e, args);
 
-            if(callbacks.size() != 0)
+        node::CallbackScope callbackScope(isolate, asyncResource.Get(isolate), asyncContext);
+        InvokeEventHandlers(e, genericCallbacks, args);
+        args.Shift();
+
+        if(hasSpecific)
+        {
+            if(args.HasObjects())
             {
-                auto evArgs = handler->GetArgs(this, e);
-                evArgs.insert(evArgs.begin(), V8_NEW_STRING(eventName));
+                const alt::MValueArgs& scriptArgs =
+                  local ? static_cast<const alt::CServerScriptEvent*>(e)->GetArgs() : static_cast<const alt::CClientScriptEvent*>(e)->GetArgs();
 
-                node::CallbackScope callbackScope(isolate, asyncResource.Get(isolate), asyncContext);
-                InvokeEventHandlers(e, callbacks, evArgs);
+                // The target player in front of client events is the same wrapper either way
+                args.Resize(args.size() - scriptArgs.GetSize());
+                runtime->GetArgsCache().Materialize(scriptArgs, args);
             }
+            else
+                ++eventArgsSkipped;
         }
     }
+    else
+        handler->GetArgs(this, e, args);
 
-    std::vector<V8::EventCallback*> callbacks = handler->GetCallbacks(this, e);
-    if(callbacks.size() > 0)
+    if(hasSpecific)
     {
-        std::vector<v8::Local<v8::Value>> args = handler->GetArgs(this, e);
-
         node::CallbackScope callbackScope(isolate, asyncResource.Get(isolate), asyncContext);
         InvokeEventHandlers(e, callbacks, args);
     }
@@ -222,6 +336,40 @@ bool CNodeResourceImpl::OnEvent(const alt::CEvent* e)
 }
 
 void CNodeResourceImpl::OnTick()
+{
+    bool timed = V8::EventStats::IsEnabled();
+    int64_t start = timed ? V8::EventStats::Now() : 0;
+
+    if(!CLoopPoller::IsEnabled() || IsTickReady())
+    {
+        RunTick();
+        ++activeTicks;
+    }
+    else
+        ++idleTicks;
+
+    if(timed)
+    {
+        tickTime += V8::EventStats::Now() - start;
+        ++timedTicks;
+    }
+}
+
+// Checked without entering the isolate, the cheap checks go first
+bool CNodeResourceImpl::IsTickReady()
+{
+    if(HasTickWork(GetTime())) return true;
+    if(env->tick_info()->has_tick_scheduled()) return true;
+
+    // Running a loop that isn't alive doesn't do anything
+    if(!uv_loop_alive(uvLoop)) return false;
+    if(!loopWatched) return true;
+
+    runtime->GetLoopPoller().Poll();
+    return loopReady || CLoopPoller::HasDueWork(uvLoop);
+}
+
+void CNodeResourceImpl::RunTick()
 {
     v8::Locker locker(isolate);
     v8::Isolate::Scope isolateScope(isolate);
@@ -230,6 +378,26 @@ void CNodeResourceImpl::OnTick()
     v8::Context::Scope scope(GetContext());
     node::CallbackScope callbackScope(isolate, asyncResource.Get(isolate), asyncContext);
 
+    loopReady = false;
     uv_run(uvLoop, UV_RUN_NOWAIT);
     V8ResourceImpl::OnTick();
 }
+
+void CNodeResourceImpl::LoopBenchmark()
+{
+    Log::Info << resource->GetName() << ": " << activeTicks << " ticks entered, " << idleTicks << " skipped" << (loopWatched ? "" : " (loop not watched)") << Log::Endl;
+    if(timedTicks != 0) Log::Info << resource->GetName() << ": " << tickTime / timedTicks << " ns per tick over " << timedTicks << " timed ticks" << Log::Endl;
+}
+
+void CNodeResourceImpl::OnCreateBaseObject(alt::Ref<alt::IBaseObject> handle)
+{
+    runtime->GetSpatialGrid().Add(handle.As<alt::IEntity>().Get());
+    V8ResourceImpl::OnCreateBaseObject(handle);
+}
+
+void CNodeResourceImpl::OnRemoveBaseObject(alt::Ref<alt::IBaseObject> handle)
+{
+    // The grid only holds the pointer, it has to forget the entity before it's destroyed
+    runtime->GetSpatialGrid().Remove(handle.As<alt::IEntity>().Get());
+    V8ResourceImpl::OnRemoveBaseObject(handle);
+}
@@ -26,7 +26,19 @@ public:
     bool OnEvent(const alt::CEvent* ev) override;
     void OnTick() override;
 
-    void Started(v8::Local<v8::Value> exports);
+    void OnCreateBaseObject(alt::Ref<alt::IBaseObject> handle) override;
+    void OnRemoveBaseObject(alt::Ref<alt::IBaseObject> handle) override;
+
+    void Started(v8::Local<v8::Value> exports, double importTime, double startTime);
+
+    // Called by CLoopPoller when the backend of the loop has I/O
+    void SetLoopReady()
+    {
+        loopReady = true;
+    }
+
+    void LoopBenchmark();
+
     node::Environment* GetEnv()
     {
         return env;
@@ -43,12 +55,30 @@ public:
 private:
     CNodeScriptRuntime* runtime;
 
+    // How long Start blocks on the loop at most before draining the platform tasks again, in ms
+    static constexpr uint64_t StartWakeupInterval = 5;
+
     bool envStarted = false;
     bool startError = false;
 
+    // Bootstrap phases as measured by the script, in ms
+    double importTime = 0;
+    double startFnTime = 0;
+
     node::IsolateData* nodeData = nullptr;
     node::Environment* env = nullptr;
     uv_loop_t* uvLoop = nullptr;
+    bool loopWatched = false;
+    bool loopReady = false;
+
+    uint64_t activeTicks = 0;
+    uint64_t idleTicks = 0;
+    // Time spent in OnTick while event stats are enabled, in ns
+    int64_t tickTime = 0;
+    uint64_t timedTicks = 0;
+
+    bool IsTickReady();
+    void RunTick();
     v8::Persistent<v8::Object> asyncResource;
     node::async_context asyncContext{};
 };
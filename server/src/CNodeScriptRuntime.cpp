@@ -1,7 +1,59 @@
 #include "stdafx.h"
 
+#include <algorithm>
+#include <fstream>
+#include <thread>
+
 #include "CNodeScriptRuntime.h"
 
+static std::string Trim(const std::string& str, const char* chars)
+{
+    size_t begin = str.find_first_not_of(chars);
+    if(begin == std::string::npos) return {};
+
+    return str.substr(begin, str.find_last_not_of(chars) - begin + 1);
+}
+
+// The runtime is created before any resource and the SDK doesn't expose server.cfg,
+// so the flat "js-module-*" entries are read from the file directly
+static std::unordered_map<std::string, std::string> ReadServerConfig()
+{
+    std::unordered_map<std::string, std::string> values;
+
+    std::ifstream file(alt::ICore::Instance().GetRootDirectory().ToString() + "/server.cfg");
+    std::string line;
+    while(std::getline(file, line))
+    {
+        line = line.substr(0, line.find('#'));
+
+        size_t colon = line.find(':');
+        if(colon == std::string::npos) continue;
+
+        std::string key = Trim(line.substr(0, colon), " \t");
+        if(key.rfind("js-module-", 0) != 0) continue;
+
+        values[key] = Trim(Trim(line.substr(colon + 1), " \t\r,"), "\"'");
+    }
+
+    return values;
+}
+
+static int64_t GetConfigInt(const std::unordered_map<std::string, std::string>& config, const std::string& key, int64_t defaultValue)
+{
+    auto it = config.find(key);
+    if(it == config.end() || it->second.empty()) return defaultValue;
+
+    return std::strtoll(it->second.c_str(), nullptr, 10);
+}
+
+static bool GetConfigBool(const std::unordered_map<std::string, std::string>& config, const std::string& key, bool defaultValue)
+{
+    auto it = config.find(key);
+    if(it == config.end() || it->second.empty()) return defaultValue;
+
+    return it->second == "true";
+}
+
 CNodeScriptRuntime::CNodeScriptRuntime()
 {
     int eac;
@@ -12,10 +64,31 @@ CNodeScriptRuntime::CNodeScriptRuntime()
 
     node::Init(&argc, argv, &eac, &eav);
 
+    auto config = ReadServerConfig();
+
+    // 0 uses a thread per core
+    int threads = int(GetConfigInt(config, "js-module-platform-threads", 4));
+    if(threads <= 0) threads = int(std::max(1u, std::thread::hardware_concurrency()));
+
+    // In MB, 0 keeps the V8 defaults
+    size_t maxOldGenerationSize = size_t(std::max<int64_t>(0, GetConfigInt(config, "js-module-max-old-space-size", 0))) * 1024 * 1024;
+    size_t maxYoungGenerationSize = size_t(std::max<int64_t>(0, GetConfigInt(config, "js-module-max-young-space-size", 0))) * 1024 * 1024;
+
+    std::string flags;
+    if(!GetConfigBool(config, "js-module-concurrent-marking", true)) flags += " --no-concurrent-marking";
+    if(!GetConfigBool(config, "js-module-concurrent-compilation", true)) flags += " --no-concurrent-recompilation";
+    if(config.count("js-module-v8-flags") != 0) flags += " " + config["js-module-v8-flags"];
+    if(!flags.empty()) v8::V8::SetFlagsFromString(flags.c_str(), flags.size());
+
+    // Has to be known before the classes are loaded
+    if(GetConfigBool(config, "js-module-weak-entities", false)) V8Entity::AllowWeak();
+
+    Log::Info << "[V8] Platform with " << threads << " worker threads" << (flags.empty() ? "" : ", flags:" + flags) << Log::Endl;
+
     auto* tracing_agent = node::CreateAgent();
     // auto* tracing_controller = tracing_agent->GetTracingController();
     node::tracing::TraceEventHelper::SetAgent(tracing_agent);
-    platform.reset(node::CreatePlatform(4, node::tracing::TraceEventHelper::GetTracingController()));
+    platform.reset(new CNodePlatform(threads, node::tracing::TraceEventHelper::GetTracingController()));
 
     v8::V8::InitializePlatform(platform.get());
     v8::V8::Initialize();
@@ -27,6 +100,9 @@ CNodeScriptRuntime::CNodeScriptRuntime()
     v8::Isolate::CreateParams params;
     params.array_buffer_allocator = node::CreateArrayBufferAllocator();
 
+    if(maxOldGenerationSize != 0) params.constraints.set_max_old_generation_size_in_bytes(maxOldGenerationSize);
+    if(maxYoungGenerationSize != 0) params.constraints.set_max_young_generation_size_in_bytes(maxYoungGenerationSize);
+
     v8::Isolate::Initialize(isolate, params);
 
     // IsWorker data slot
@@ -57,10 +133,28 @@ void CNodeScriptRuntime::OnTick()
     v8::SealHandleScope seal(isolate);
 
     platform->DrainTasks(isolate);
+
+    // Events of the last tick have been delivered to every resource
+    argsCache.Clear();
+
+    // Entities may have moved since the last tick, positions are read again on the next query
+    spatialGrid.Invalidate();
+
+    loopPoller.NextTick();
+
+    // Skipped resources don't leave a callback scope, which would have run the microtasks
+    if(CLoopPoller::IsEnabled())
+    {
+        v8::HandleScope handleScope(isolate);
+        isolate->PerformMicrotaskCheckpoint();
+    }
 }
 
 void CNodeScriptRuntime::OnDispose()
 {
+    argsCache.Clear();
+    spatialGrid.Clear();
+
     /*{
             v8::SealHandleScope seal(isolate);
 
@@ -5,12 +5,28 @@
 
 #include "V8Helpers.h"
 #include "CNodeResourceImpl.h"
+#include "CSpatialGrid.h"
+#include "CLoopPoller.h"
+#include "CNodePlatform.h"
 
 class CNodeScriptRuntime : public alt::IScriptRuntime
 {
+public:
+    struct BootstrapCache
+    {
+        std::vector<uint8_t> data;
+        // V8 would reject a recreated cache for every resource as well, it isn't written again
+        bool rejected = false;
+    };
+
+private:
     v8::Isolate* isolate;
-    std::unique_ptr<node::MultiIsolatePlatform> platform;
+    std::unique_ptr<CNodePlatform> platform;
     std::unordered_set<CNodeResourceImpl*> resources;
+    V8::MValueArgsCache argsCache;
+    CSpatialGrid spatialGrid;
+    CLoopPoller loopPoller;
+    BootstrapCache bootstrapCache;
 
 public:
     CNodeScriptRuntime();
@@ -25,14 +41,38 @@ public:
 
     void DestroyImpl(alt::IResource::Impl* impl) override
     {
-        resources.insert(static_cast<CNodeResourceImpl*>(impl));
+        resources.erase(static_cast<CNodeResourceImpl*>(impl));
         delete static_cast<CNodeResourceImpl*>(impl);
+
+        // Without a resource the grid doesn't get the remove hooks, it's seeded again on the next query
+        if(resources.empty()) spatialGrid.Clear();
     }
 
     void OnTick() override;
     void OnDispose() override;
 
-    node::MultiIsolatePlatform* GetPlatform() const
+    V8::MValueArgsCache& GetArgsCache()
+    {
+        return argsCache;
+    }
+
+    CSpatialGrid& GetSpatialGrid()
+    {
+        return spatialGrid;
+    }
+
+    CLoopPoller& GetLoopPoller()
+    {
+        return loopPoller;
+    }
+
+    // Code cache of the resource bootstrap, empty until the first resource started
+    BootstrapCache& GetBootstrapCache()
+    {
+        return bootstrapCache;
+    }
+
+    CNodePlatform* GetPlatform() const
     {
         return platform.get();
     }
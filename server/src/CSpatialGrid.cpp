@@ -0,0 +1,191 @@
+#include "stdafx.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "CSpatialGrid.h"
+
+// Clamped as coordinates far out of the map would overflow, NaN ends up in the lowest cell
+int32_t CSpatialGrid::CellCoord(float val)
+{
+    double cell = std::floor(double(val) / CellSize);
+    if(!(cell > INT32_MIN)) return INT32_MIN;
+    if(cell > INT32_MAX) return INT32_MAX;
+
+    return int32_t(cell);
+}
+
+void CSpatialGrid::QueryRange(const alt::Vector3f& pos, float range, int32_t dimension, uint32_t typeMask, std::vector<Result>& out)
+{
+    if(dirty) Update();
+
+    float rangeSq = range * range;
+
+    int32_t minX = CellCoord(pos[0] - range);
+    int32_t maxX = CellCoord(pos[0] + range);
+    int32_t minY = CellCoord(pos[1] - range);
+    int32_t maxY = CellCoord(pos[1] + range);
+
+    // Large ranges cover more cells than are occupied, visit those instead
+    uint64_t cellCount = uint64_t(int64_t(maxX) - minX + 1) * uint64_t(int64_t(maxY) - minY + 1);
+    if(cellCount > cells.size())
+    {
+        for(auto& [key, list] : cells) Collect(list, pos, rangeSq, dimension, typeMask, out);
+        return;
+    }
+
+    // Wider than the coordinates, maxX may be the largest cell
+    for(int64_t x = minX; x <= maxX; ++x)
+    {
+        for(int64_t y = minY; y <= maxY; ++y)
+        {
+            auto it = cells.find(CellKey(int32_t(x), int32_t(y)));
+            if(it != cells.end()) Collect(it->second, pos, rangeSq, dimension, typeMask, out);
+        }
+    }
+}
+
+void CSpatialGrid::QueryClosest(const alt::Vector3f& pos, float range, int32_t dimension, uint32_t typeMask, size_t limit, std::vector<Result>& out)
+{
+    size_t first = out.size();
+    QueryRange(pos, range, dimension, typeMask, out);
+
+    auto byDist = [](const Result& a, const Result& b) { return a.distSq < b.distSq; };
+    if(out.size() - first > limit)
+    {
+        std::partial_sort(out.begin() + first, out.begin() + first + limit, out.end(), byDist);
+        out.resize(first + limit);
+    }
+    else
+        std::sort(out.begin() + first, out.end(), byDist);
+}
+
+void CSpatialGrid::Add(alt::IEntity* entity)
+{
+    if(!entity || !seeded || slots.count(entity) != 0) return;
+
+    uint32_t index = uint32_t(items.size());
+    items.push_back(Item{ entity });
+    items[index].typeBit = 1u << uint32_t(entity->GetType());
+    slots.insert({ entity, index });
+
+    alt::Vector3f pos = entity->GetPosition();
+    Item& item = items[index];
+    item.x = pos[0];
+    item.y = pos[1];
+    item.z = pos[2];
+    item.dimension = entity->GetDimension();
+    AddToCell(index, CellKey(CellCoord(pos[0]), CellCoord(pos[1])));
+}
+
+void CSpatialGrid::Remove(alt::IEntity* entity)
+{
+    auto it = slots.find(entity);
+    if(it != slots.end()) RemoveItem(it->second);
+}
+
+void CSpatialGrid::Clear()
+{
+    items.clear();
+    slots.clear();
+    cells.clear();
+    dirty = true;
+    seeded = false;
+}
+
+void CSpatialGrid::Seed()
+{
+    seeded = true;
+
+    alt::Array<alt::Ref<alt::IEntity>> all = alt::ICore::Instance().GetEntities();
+    for(uint32_t i = 0; i < all.GetSize(); ++i) Add(all[i].Get());
+}
+
+void CSpatialGrid::Update()
+{
+    dirty = false;
+
+    if(!seeded)
+    {
+        Seed();
+        return;
+    }
+
+    for(uint32_t i = 0; i < items.size(); ++i) Place(i);
+}
+
+// Reads the position of the entity, it only changes cells when it left its current one
+void CSpatialGrid::Place(uint32_t index)
+{
+    Item& item = items[index];
+    alt::Vector3f pos = item.entity->GetPosition();
+
+    item.x = pos[0];
+    item.y = pos[1];
+    item.z = pos[2];
+    item.dimension = item.entity->GetDimension();
+
+    uint64_t cell = CellKey(CellCoord(pos[0]), CellCoord(pos[1]));
+    if(cell != item.cell)
+    {
+        RemoveFromCell(index);
+        AddToCell(index, cell);
+    }
+}
+
+void CSpatialGrid::AddToCell(uint32_t index, uint64_t cell)
+{
+    std::vector<uint32_t>& list = cells[cell];
+
+    items[index].cell = cell;
+    items[index].indexInCell = uint32_t(list.size());
+    list.push_back(index);
+}
+
+void CSpatialGrid::RemoveFromCell(uint32_t index)
+{
+    Item& item = items[index];
+    auto it = cells.find(item.cell);
+    std::vector<uint32_t>& list = it->second;
+
+    uint32_t moved = list.back();
+    list[item.indexInCell] = moved;
+    items[moved].indexInCell = item.indexInCell;
+    list.pop_back();
+
+    if(list.empty()) cells.erase(it);
+}
+
+void CSpatialGrid::RemoveItem(uint32_t index)
+{
+    RemoveFromCell(index);
+    slots.erase(items[index].entity);
+
+    uint32_t last = uint32_t(items.size() - 1);
+    if(index != last)
+    {
+        items[index] = items[last];
+
+        Item& item = items[index];
+        slots[item.entity] = index;
+        cells[item.cell][item.indexInCell] = index;
+    }
+
+    items.pop_back();
+}
+
+void CSpatialGrid::Collect(const std::vector<uint32_t>& list, const alt::Vector3f& pos, float rangeSq, int32_t dimension, uint32_t typeMask, std::vector<Result>& out)
+{
+    for(uint32_t index : list)
+    {
+        const Item& item = items[index];
+        if(item.dimension != dimension || !(item.typeBit & typeMask)) continue;
+
+        float dx = item.x - pos[0];
+        float dy = item.y - pos[1];
+        float dz = item.z - pos[2];
+        float distSq = dx * dx + dy * dy + dz * dz;
+
+        if(distSq <= rangeSq) out.push_back({ item.entity, distSq });
+    }
+}
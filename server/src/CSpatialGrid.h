@@ -0,0 +1,70 @@
+#pragma once
+
+#include <unordered_map>
+#include <vector>
+
+#include "cpp-sdk/objects/IEntity.h"
+
+// Uniform grid over the x/y positions of all entities, used for proximity queries.
+// Entities are added and removed through the base object hooks of the resources, positions change every tick
+// without an event, so they are refreshed on the first query after the grid was invalidated, moving only the
+// entities that changed cells. Holds raw pointers, the remove hook has to run before an entity is destroyed
+class CSpatialGrid
+{
+public:
+    static constexpr float CellSize = 128.f;
+
+    struct Result
+    {
+        alt::IEntity* entity;
+        float distSq;
+    };
+
+    void Invalidate()
+    {
+        dirty = true;
+    }
+
+    // Entities within range of pos in the dimension, typeMask has the bit (1 << type) of every wanted type set
+    void QueryRange(const alt::Vector3f& pos, float range, int32_t dimension, uint32_t typeMask, std::vector<Result>& out);
+
+    // The closest limit entities within range, sorted by distance
+    void QueryClosest(const alt::Vector3f& pos, float range, int32_t dimension, uint32_t typeMask, size_t limit, std::vector<Result>& out);
+
+    void Add(alt::IEntity* entity);
+    void Remove(alt::IEntity* entity);
+    void Clear();
+
+private:
+    struct Item
+    {
+        alt::IEntity* entity;
+        float x, y, z;
+        int32_t dimension;
+        uint32_t typeBit;
+        uint64_t cell;
+        uint32_t indexInCell;
+    };
+
+    std::vector<Item> items;
+    std::unordered_map<alt::IEntity*, uint32_t> slots;
+    std::unordered_map<uint64_t, std::vector<uint32_t>> cells;
+    bool dirty = true;
+    // Entities created before the first resource started didn't go through the hooks
+    bool seeded = false;
+
+    void Seed();
+    void Update();
+    void Place(uint32_t index);
+    void AddToCell(uint32_t index, uint64_t cell);
+    void RemoveFromCell(uint32_t index);
+    void RemoveItem(uint32_t index);
+    void Collect(const std::vector<uint32_t>& list, const alt::Vector3f& pos, float rangeSq, int32_t dimension, uint32_t typeMask, std::vector<Result>& out);
+
+    static int32_t CellCoord(float val);
+
+    static uint64_t CellKey(int32_t x, int32_t y)
+    {
+        return (uint64_t(uint32_t(x)) << 32) | uint32_t(y);
+    }
+};
@@ -1,7 +1,10 @@
 #include "stdafx.h"
 
+#include <cmath>
+
 #include "V8Module.h"
 #include "CNodeResourceImpl.h"
+#include "CNodeScriptRuntime.h"
 
 using namespace alt;
 
@@ -239,6 +242,67 @@ static void GetResourceExports(const v8::FunctionCallbackInfo<v8::Value>& info)
     }
 }
 
+static v8::Local<v8::Array> SpatialResultsToJS(V8ResourceImpl* resource, const std::vector<CSpatialGrid::Result>& results)
+{
+    v8::Isolate* isolate = resource->GetIsolate();
+    v8::Local<v8::Context> ctx = resource->GetContext();
+
+    v8::Local<v8::Array> arr = v8::Array::New(isolate, results.size());
+    for(uint32_t i = 0; i < results.size(); ++i) arr->Set(ctx, i, resource->GetBaseObjectOrNull(results[i].entity));
+
+    return arr;
+}
+
+// typeMask has the bit (1 << alt.BaseObjectType) of every wanted type set, all types if it's omitted
+static void GetEntitiesInRange(const v8::FunctionCallbackInfo<v8::Value>& info)
+{
+    V8_GET_ISOLATE_CONTEXT_RESOURCE();
+    V8_CHECK_ARGS_LEN2(3, 4);
+
+    V8_ARG_TO_VECTOR3(1, pos);
+    V8_ARG_TO_NUMBER(2, range);
+    V8_ARG_TO_INT(3, dimension);
+    V8_CHECK(std::isfinite(range), "Range must be a finite number");
+    V8_CHECK(range >= 0, "Range must not be negative");
+
+    uint32_t typeMask = UINT32_MAX;
+    if(info.Length() == 4)
+    {
+        V8_ARG_TO_UINT(4, mask);
+        typeMask = mask;
+    }
+
+    std::vector<CSpatialGrid::Result> results;
+    CNodeScriptRuntime::Instance().GetSpatialGrid().QueryRange(pos, (float)range, (int32_t)dimension, typeMask, results);
+
+    V8_RETURN(SpatialResultsToJS(resource, results));
+}
+
+static void GetClosestEntities(const v8::FunctionCallbackInfo<v8::Value>& info)
+{
+    V8_GET_ISOLATE_CONTEXT_RESOURCE();
+    V8_CHECK_ARGS_LEN2(4, 5);
+
+    V8_ARG_TO_VECTOR3(1, pos);
+    V8_ARG_TO_NUMBER(2, range);
+    V8_ARG_TO_INT(3, dimension);
+    V8_ARG_TO_UINT(4, limit);
+    V8_CHECK(std::isfinite(range), "Range must be a finite number");
+    V8_CHECK(range >= 0, "Range must not be negative");
+
+    uint32_t typeMask = UINT32_MAX;
+    if(info.Length() == 5)
+    {
+        V8_ARG_TO_UINT(5, mask);
+        typeMask = mask;
+    }
+
+    std::vector<CSpatialGrid::Result> results;
+    CNodeScriptRuntime::Instance().GetSpatialGrid().QueryClosest(pos, (float)range, (int32_t)dimension, typeMask, limit, results);
+
+    V8_RETURN(SpatialResultsToJS(resource, results));
+}
+
 extern V8Class v8Player, v8Vehicle, v8Blip, v8AreaBlip, v8RadiusBlip, v8PointBlip, v8Checkpoint, v8VoiceChannel, v8Colshape, v8ColshapeCylinder, v8ColshapeSphere, v8ColshapeCircle, v8ColshapeCuboid,
   v8ColshapeRectangle;
 
@@ -272,6 +336,9 @@ extern V8Module
 
             V8Helpers::RegisterFunc(exports, "setPassword", &SetPassword);
 
+            V8Helpers::RegisterFunc(exports, "getEntitiesInRange", &GetEntitiesInRange);
+            V8Helpers::RegisterFunc(exports, "getClosestEntities", &GetClosestEntities);
+
             V8_OBJECT_SET_STRING(exports, "rootDir", alt::ICore::Instance().GetRootDirectory());
             V8_OBJECT_SET_INT(exports, "defaultDimension", alt::DEFAULT_DIMENSION);
             V8_OBJECT_SET_INT(exports, "globalDimension", alt::GLOBAL_DIMENSION);
@@ -370,6 +370,26 @@ static void AllGetter(v8::Local<v8::String> name, const v8::PropertyCallbackInfo
     V8_RETURN(resource->GetAllPlayers());
 }
 
+static void StaticGetPositions(const v8::FunctionCallbackInfo<v8::Value>& info)
+{
+    V8::SnapshotPositions(info, alt::ICore::Instance().GetPlayers());
+}
+
+static void StaticGetRotations(const v8::FunctionCallbackInfo<v8::Value>& info)
+{
+    V8::SnapshotRotations(info, alt::ICore::Instance().GetPlayers());
+}
+
+static void StaticGetIds(const v8::FunctionCallbackInfo<v8::Value>& info)
+{
+    V8::SnapshotIds(info, alt::ICore::Instance().GetPlayers());
+}
+
+static void StaticGetDimensions(const v8::FunctionCallbackInfo<v8::Value>& info)
+{
+    V8::SnapshotDimensions(info, alt::ICore::Instance().GetPlayers());
+}
+
 static void StaticGetByID(const v8::FunctionCallbackInfo<v8::Value>& info)
 {
     V8_GET_ISOLATE_CONTEXT_RESOURCE();
@@ -409,6 +429,10 @@ extern V8Class v8Player("Player", v8Entity, nullptr, [](v8::Local<v8::FunctionTe
     v8::Local<v8::ObjectTemplate> proto = tpl->PrototypeTemplate();
 
     V8::SetStaticMethod(isolate, tpl, "getByID", &StaticGetByID);
+    V8::SetStaticMethod(isolate, tpl, "getPositions", &StaticGetPositions);
+    V8::SetStaticMethod(isolate, tpl, "getRotations", &StaticGetRotations);
+    V8::SetStaticMethod(isolate, tpl, "getIds", &StaticGetIds);
+    V8::SetStaticMethod(isolate, tpl, "getDimensions", &StaticGetDimensions);
     V8::SetStaticAccessor(isolate, tpl, "all", &AllGetter);
 
     V8::SetAccessor<IPlayer, uint32_t, &IPlayer::GetPing>(isolate, tpl, "ping");
@@ -71,6 +71,26 @@ static void AllGetter(v8::Local<v8::String> name, const v8::PropertyCallbackInfo
     V8_RETURN(resource->GetAllVehicles());
 }
 
+static void StaticGetPositions(const v8::FunctionCallbackInfo<v8::Value>& info)
+{
+    V8::SnapshotPositions(info, alt::ICore::Instance().GetVehicles());
+}
+
+static void StaticGetRotations(const v8::FunctionCallbackInfo<v8::Value>& info)
+{
+    V8::SnapshotRotations(info, alt::ICore::Instance().GetVehicles());
+}
+
+static void StaticGetIds(const v8::FunctionCallbackInfo<v8::Value>& info)
+{
+    V8::SnapshotIds(info, alt::ICore::Instance().GetVehicles());
+}
+
+static void StaticGetDimensions(const v8::FunctionCallbackInfo<v8::Value>& info)
+{
+    V8::SnapshotDimensions(info, alt::ICore::Instance().GetVehicles());
+}
+
 static void StaticGetByID(const v8::FunctionCallbackInfo<v8::Value>& info)
 {
     V8_GET_ISOLATE_CONTEXT_RESOURCE();
@@ -147,42 +167,97 @@ static void SetSearchLight(const v8::FunctionCallbackInfo<v8::Value>& info)
 }
 
 extern V8Class v8Entity;
+static constexpr V8::Property vehicleProperties[] = {
+    // Common getter/setters
+    V8_PROPERTY("destroyed", IVehicle, bool, &IVehicle::IsDestroyed),
+    V8_PROPERTY("driver", IVehicle, Ref<IPlayer>, &IVehicle::GetDriver),
+    V8_PROPERTY("velocity", IVehicle, Vector3f, &IVehicle::GetVelocity),
+
+    // Appearance getters/setters
+    { "modKit", &ModKitGetter, &ModKitSetter },
+    V8_PROPERTY("modKitsCount", IVehicle, uint8_t, &IVehicle::GetModKitsCount),
+    V8_PROPERTY("primaryColor", IVehicle, uint8_t, &IVehicle::GetPrimaryColor, &IVehicle::SetPrimaryColor),
+    V8_PROPERTY("secondaryColor", IVehicle, uint8_t, &IVehicle::GetSecondaryColor, &IVehicle::SetSecondaryColor),
+    V8_PROPERTY("customPrimaryColor", IVehicle, RGBA, &IVehicle::GetPrimaryColorRGB, &IVehicle::SetPrimaryColorRGB),
+    V8_PROPERTY("customSecondaryColor", IVehicle, RGBA, &IVehicle::GetSecondaryColorRGB, &IVehicle::SetSecondaryColorRGB),
+    V8_PROPERTY("tireSmokeColor", IVehicle, RGBA, &IVehicle::GetTireSmokeColor, &IVehicle::SetTireSmokeColor),
+    V8_PROPERTY("neonColor", IVehicle, RGBA, &IVehicle::GetNeonColor, &IVehicle::SetNeonColor),
+    V8_PROPERTY("pearlColor", IVehicle, uint8_t, &IVehicle::GetPearlColor, &IVehicle::SetPearlColor),
+    V8_PROPERTY("wheelColor", IVehicle, uint8_t, &IVehicle::GetWheelColor, &IVehicle::SetWheelColor),
+    V8_PROPERTY("interiorColor", IVehicle, uint8_t, &IVehicle::GetInteriorColor, &IVehicle::SetInteriorColor),
+    V8_PROPERTY("dashboardColor", IVehicle, uint8_t, &IVehicle::GetDashboardColor, &IVehicle::SetDashboardColor),
+    V8_PROPERTY("customTires", IVehicle, bool, &IVehicle::GetCustomTires, &IVehicle::SetCustomTires),
+    V8_PROPERTY("darkness", IVehicle, uint8_t, &IVehicle::GetSpecialDarkness, &IVehicle::SetSpecialDarkness),
+    V8_PROPERTY("windowTint", IVehicle, uint8_t, &IVehicle::GetWindowTint, &IVehicle::SetWindowTint),
+    { "neon", &NeonActiveGetter, &NeonActiveSetter },
+    V8_PROPERTY("dirtLevel", IVehicle, uint8_t, &IVehicle::GetDirtLevel, &IVehicle::SetDirtLevel),
+    V8_PROPERTY("numberPlateIndex", IVehicle, uint32_t, &IVehicle::GetNumberplateIndex, &IVehicle::SetNumberplateIndex),
+    V8_PROPERTY("numberPlateText", IVehicle, StringView, &IVehicle::GetNumberplateText, &IVehicle::SetNumberplateText),
+    V8_PROPERTY("livery", IVehicle, uint8_t, &IVehicle::GetLivery, &IVehicle::SetLivery),
+    V8_PROPERTY("roofLivery", IVehicle, uint8_t, &IVehicle::GetRoofLivery, &IVehicle::SetRoofLivery),
+    V8_PROPERTY("wheelType", IVehicle, uint8_t, &IVehicle::GetWheelType),
+    V8_PROPERTY("frontWheels", IVehicle, uint8_t, &IVehicle::GetWheelVariation),
+    V8_PROPERTY("rearWheels", IVehicle, uint8_t, &IVehicle::GetRearWheelVariation),
+
+    // Gamestate getters/setters
+    V8_PROPERTY("engineOn", IVehicle, bool, &IVehicle::IsEngineOn, &IVehicle::SetEngineOn),
+    V8_PROPERTY("handbrakeActive", IVehicle, bool, &IVehicle::IsHandbrakeActive),
+    V8_PROPERTY("headlightColor", IVehicle, uint8_t, &IVehicle::GetHeadlightColor, &IVehicle::SetHeadlightColor),
+    V8_PROPERTY("sirenActive", IVehicle, bool, &IVehicle::IsSirenActive, &IVehicle::SetSirenActive),
+    V8_PROPERTY("lockState", IVehicle, uint8_t, &IVehicle::GetLockState, &IVehicle::SetLockState),
+    V8_PROPERTY("daylightOn", IVehicle, bool, &IVehicle::IsDaylightOn),
+    V8_PROPERTY("nightlightOn", IVehicle, bool, &IVehicle::IsNightlightOn),
+    V8_PROPERTY("roofState", IVehicle, uint8_t, &IVehicle::GetRoofState, &IVehicle::SetRoofState),
+    V8_PROPERTY("flamethrowerActive", IVehicle, bool, &IVehicle::IsFlamethrowerActive),
+    V8_PROPERTY("activeRadioStation", IVehicle, uint32_t, &IVehicle::GetRadioStationIndex, &IVehicle::SetRadioStationIndex),
+    V8_PROPERTY("lightsMultiplier", IVehicle, float, &IVehicle::GetLightsMultiplier, &IVehicle::SetLightsMultiplier),
+    V8_PROPERTY("driftModeEnabled", IVehicle, bool, &IVehicle::IsDriftMode, &IVehicle::SetDriftMode),
+
+    // Health getters/setters
+    V8_PROPERTY("engineHealth", IVehicle, int32_t, &IVehicle::GetEngineHealth, &IVehicle::SetEngineHealth),
+    V8_PROPERTY("petrolTankHealth", IVehicle, int32_t, &IVehicle::GetPetrolTankHealth, &IVehicle::SetPetrolTankHealth),
+    V8_PROPERTY("bodyHealth", IVehicle, uint32_t, &IVehicle::GetBodyHealth, &IVehicle::SetBodyHealth),
+    V8_PROPERTY("bodyAdditionalHealth", IVehicle, uint32_t, &IVehicle::GetBodyAdditionalHealth, &IVehicle::SetBodyAdditionalHealth),
+    V8_PROPERTY("wheelsCount", IVehicle, uint8_t, &IVehicle::GetWheelsCount),
+    V8_PROPERTY("repairsCount", IVehicle, uint8_t, &IVehicle::GetRepairsCount),
+
+    // Damage getters/setters
+    V8_PROPERTY("hasArmoredWindows", IVehicle, bool, &IVehicle::HasArmoredWindows),
+
+    // Script getters/setters
+    V8_PROPERTY("manualEngineControl", IVehicle, bool, &IVehicle::IsManualEngineControl, &IVehicle::SetManualEngineControl),
+    V8_PROPERTY("attached", IVehicle, Ref<IVehicle>, &IVehicle::GetAttached),
+    V8_PROPERTY("attachedTo", IVehicle, Ref<IVehicle>, &IVehicle::GetAttachedTo),
+
+    // Train getter/setter
+    V8_PROPERTY("isMissionTrain", IVehicle, bool, &IVehicle::IsTrainMissionTrain, &IVehicle::SetTrainMissionTrain),
+    V8_PROPERTY("trainTrackId", IVehicle, int8_t, &IVehicle::GetTrainTrackId, &IVehicle::SetTrainTrackId),
+    V8_PROPERTY("trainEngineId", IVehicle, Ref<IVehicle>, &IVehicle::GetTrainEngineId),
+    V8_PROPERTY("trainConfigIndex", IVehicle, int8_t, &IVehicle::GetTrainConfigIndex, &IVehicle::SetTrainConfigIndex),
+    V8_PROPERTY("trainDistanceFromEngine", IVehicle, float, &IVehicle::GetTrainDistanceFromEngine, &IVehicle::SetTrainDistanceFromEngine),
+    V8_PROPERTY("isTrainEngine", IVehicle, bool, &IVehicle::IsTrainEngine, &IVehicle::SetTrainIsEngine),
+    V8_PROPERTY("isTrainCaboose", IVehicle, bool, &IVehicle::IsTrainCaboose, &IVehicle::SetTrainIsCaboose),
+    V8_PROPERTY("trainDirection", IVehicle, bool, &IVehicle::GetTrainDirection, &IVehicle::SetTrainDirection),
+    V8_PROPERTY("trainPassengerCarriages", IVehicle, bool, &IVehicle::HasTrainPassengerCarriages, &IVehicle::SetTrainHasPassengerCarriages),
+    V8_PROPERTY("trainRenderDerailed", IVehicle, bool, &IVehicle::GetTrainRenderDerailed, &IVehicle::SetTrainRenderDerailed),
+    V8_PROPERTY("trainForceDoorsOpen", IVehicle, bool, &IVehicle::GetTrainForceDoorsOpen, &IVehicle::SetTrainForceDoorsOpen),
+    V8_PROPERTY("trainCruiseSpeed", IVehicle, float, &IVehicle::GetTrainCruiseSpeed, &IVehicle::SetTrainCruiseSpeed),
+    V8_PROPERTY("trainCarriageConfigIndex", IVehicle, int8_t, &IVehicle::GetTrainCarriageConfigIndex, &IVehicle::SetTrainCarriageConfigIndex),
+    V8_PROPERTY("trainLinkedToBackwardId", IVehicle, Ref<IVehicle>, &IVehicle::GetTrainLinkedToBackwardId),
+    V8_PROPERTY("trainLinkedToForwardId", IVehicle, Ref<IVehicle>, &IVehicle::GetTrainLinkedToForwardId),
+};
+
 extern V8Class v8Vehicle("Vehicle", v8Entity, Constructor, [](v8::Local<v8::FunctionTemplate> tpl) {
     v8::Isolate* isolate = v8::Isolate::GetCurrent();
 
     V8::SetStaticMethod(isolate, tpl, "getByID", StaticGetByID);
+    V8::SetStaticMethod(isolate, tpl, "getPositions", StaticGetPositions);
+    V8::SetStaticMethod(isolate, tpl, "getRotations", StaticGetRotations);
+    V8::SetStaticMethod(isolate, tpl, "getIds", StaticGetIds);
+    V8::SetStaticMethod(isolate, tpl, "getDimensions", StaticGetDimensions);
     V8::SetStaticAccessor(isolate, tpl, "all", AllGetter);
 
-    // Common getter/setters
-    V8::SetAccessor<IVehicle, bool, &IVehicle::IsDestroyed>(isolate, tpl, "destroyed");
-    V8::SetAccessor<IVehicle, Ref<IPlayer>, &IVehicle::GetDriver>(isolate, tpl, "driver");
-    V8::SetAccessor<IVehicle, Vector3f, &IVehicle::GetVelocity>(isolate, tpl, "velocity");
-
-    // Appearance getters/setters
-    V8::SetAccessor(isolate, tpl, "modKit", &ModKitGetter, &ModKitSetter);
-    V8::SetAccessor<IVehicle, uint8_t, &IVehicle::GetModKitsCount>(isolate, tpl, "modKitsCount");
-    V8::SetAccessor<IVehicle, uint8_t, &IVehicle::GetPrimaryColor, &IVehicle::SetPrimaryColor>(isolate, tpl, "primaryColor");
-    V8::SetAccessor<IVehicle, uint8_t, &IVehicle::GetSecondaryColor, &IVehicle::SetSecondaryColor>(isolate, tpl, "secondaryColor");
-    V8::SetAccessor<IVehicle, RGBA, &IVehicle::GetPrimaryColorRGB, &IVehicle::SetPrimaryColorRGB>(isolate, tpl, "customPrimaryColor");
-    V8::SetAccessor<IVehicle, RGBA, &IVehicle::GetSecondaryColorRGB, &IVehicle::SetSecondaryColorRGB>(isolate, tpl, "customSecondaryColor");
-    V8::SetAccessor<IVehicle, RGBA, &IVehicle::GetTireSmokeColor, &IVehicle::SetTireSmokeColor>(isolate, tpl, "tireSmokeColor");
-    V8::SetAccessor<IVehicle, RGBA, &IVehicle::GetNeonColor, &IVehicle::SetNeonColor>(isolate, tpl, "neonColor");
-    V8::SetAccessor<IVehicle, uint8_t, &IVehicle::GetPearlColor, &IVehicle::SetPearlColor>(isolate, tpl, "pearlColor");
-    V8::SetAccessor<IVehicle, uint8_t, &IVehicle::GetWheelColor, &IVehicle::SetWheelColor>(isolate, tpl, "wheelColor");
-    V8::SetAccessor<IVehicle, uint8_t, &IVehicle::GetInteriorColor, &IVehicle::SetInteriorColor>(isolate, tpl, "interiorColor");
-    V8::SetAccessor<IVehicle, uint8_t, &IVehicle::GetDashboardColor, &IVehicle::SetDashboardColor>(isolate, tpl, "dashboardColor");
-    V8::SetAccessor<IVehicle, bool, &IVehicle::GetCustomTires, &IVehicle::SetCustomTires>(isolate, tpl, "customTires");
-    V8::SetAccessor<IVehicle, uint8_t, &IVehicle::GetSpecialDarkness, &IVehicle::SetSpecialDarkness>(isolate, tpl, "darkness");
-    V8::SetAccessor<IVehicle, uint8_t, &IVehicle::GetWindowTint, &IVehicle::SetWindowTint>(isolate, tpl, "windowTint");
-    V8::SetAccessor(isolate, tpl, "neon", &NeonActiveGetter, &NeonActiveSetter);
-    V8::SetAccessor<IVehicle, uint8_t, &IVehicle::GetDirtLevel, &IVehicle::SetDirtLevel>(isolate, tpl, "dirtLevel");
-    V8::SetAccessor<IVehicle, uint32_t, &IVehicle::GetNumberplateIndex, &IVehicle::SetNumberplateIndex>(isolate, tpl, "numberPlateIndex");
-    V8::SetAccessor<IVehicle, StringView, &IVehicle::GetNumberplateText, &IVehicle::SetNumberplateText>(isolate, tpl, "numberPlateText");
-    V8::SetAccessor<IVehicle, uint8_t, &IVehicle::GetLivery, &IVehicle::SetLivery>(isolate, tpl, "livery");
-    V8::SetAccessor<IVehicle, uint8_t, &IVehicle::GetRoofLivery, &IVehicle::SetRoofLivery>(isolate, tpl, "roofLivery");
-    V8::SetAccessor<IVehicle, uint8_t, &IVehicle::GetWheelType>(isolate, tpl, "wheelType");
-    V8::SetAccessor<IVehicle, uint8_t, &IVehicle::GetWheelVariation>(isolate, tpl, "frontWheels");
-    V8::SetAccessor<IVehicle, uint8_t, &IVehicle::GetRearWheelVariation>(isolate, tpl, "rearWheels");
+    V8::SetAccessors(isolate, tpl, vehicleProperties);
 
     // Appearance methods
     V8::SetMethod(isolate, tpl, "getModsCount", &GetModsCount);
@@ -195,20 +270,6 @@ extern V8Class v8Vehicle("Vehicle", v8Entity, Constructor, [](v8::Local<v8::Func
     V8::SetMethod(isolate, tpl, "getAppearanceDataBase64", &GetAppearanceData);
     V8::SetMethod(isolate, tpl, "setAppearanceDataBase64", &SetAppearanceData);
 
-    // Gamestate getters/setters
-    V8::SetAccessor<IVehicle, bool, &IVehicle::IsEngineOn, &IVehicle::SetEngineOn>(isolate, tpl, "engineOn");
-    V8::SetAccessor<IVehicle, bool, &IVehicle::IsHandbrakeActive>(isolate, tpl, "handbrakeActive");
-    V8::SetAccessor<IVehicle, uint8_t, &IVehicle::GetHeadlightColor, &IVehicle::SetHeadlightColor>(isolate, tpl, "headlightColor");
-    V8::SetAccessor<IVehicle, bool, &IVehicle::IsSirenActive, &IVehicle::SetSirenActive>(isolate, tpl, "sirenActive");
-    V8::SetAccessor<IVehicle, uint8_t, &IVehicle::GetLockState, &IVehicle::SetLockState>(isolate, tpl, "lockState");
-    V8::SetAccessor<IVehicle, bool, &IVehicle::IsDaylightOn>(isolate, tpl, "daylightOn");
-    V8::SetAccessor<IVehicle, bool, &IVehicle::IsNightlightOn>(isolate, tpl, "nightlightOn");
-    V8::SetAccessor<IVehicle, uint8_t, &IVehicle::GetRoofState, &IVehicle::SetRoofState>(isolate, tpl, "roofState");
-    V8::SetAccessor<IVehicle, bool, &IVehicle::IsFlamethrowerActive>(isolate, tpl, "flamethrowerActive");
-    V8::SetAccessor<IVehicle, uint32_t, &IVehicle::GetRadioStationIndex, &IVehicle::SetRadioStationIndex>(isolate, tpl, "activeRadioStation");
-    V8::SetAccessor<IVehicle, float, &IVehicle::GetLightsMultiplier, &IVehicle::SetLightsMultiplier>(isolate, tpl, "lightsMultiplier");
-    V8::SetAccessor<IVehicle, bool, &IVehicle::IsDriftMode, &IVehicle::SetDriftMode>(isolate, tpl, "driftModeEnabled");
-
     // Gamestate methods
     V8::SetMethod(isolate, tpl, "getDoorState", &GetDoorState);
     V8::SetMethod(isolate, tpl, "setDoorState", &SetDoorState);
@@ -217,13 +278,6 @@ extern V8Class v8Vehicle("Vehicle", v8Entity, Constructor, [](v8::Local<v8::Func
     V8::SetMethod(isolate, tpl, "getGamestateDataBase64", &GetGamestateData);
     V8::SetMethod(isolate, tpl, "setGamestateDataBase64", &SetGamestateData);
 
-    // Health getters/setters
-    V8::SetAccessor<IVehicle, int32_t, &IVehicle::GetEngineHealth, &IVehicle::SetEngineHealth>(isolate, tpl, "engineHealth");
-    V8::SetAccessor<IVehicle, int32_t, &IVehicle::GetPetrolTankHealth, &IVehicle::SetPetrolTankHealth>(isolate, tpl, "petrolTankHealth");
-    V8::SetAccessor<IVehicle, uint32_t, &IVehicle::GetBodyHealth, &IVehicle::SetBodyHealth>(isolate, tpl, "bodyHealth");
-    V8::SetAccessor<IVehicle, uint32_t, &IVehicle::GetBodyAdditionalHealth, &IVehicle::SetBodyAdditionalHealth>(isolate, tpl, "bodyAdditionalHealth");
-    V8::SetAccessor<IVehicle, uint8_t, &IVehicle::GetWheelsCount>(isolate, tpl, "wheelsCount");
-    V8::SetAccessor<IVehicle, uint8_t, &IVehicle::GetRepairsCount>(isolate, tpl, "repairsCount");
     /*proto->SetAccessor(v8::String::NewFromUtf8(isolate, "lastAttacker"), &LastAttackerGetter);
     proto->SetAccessor(v8::String::NewFromUtf8(isolate, "lastAttackedWith"), &LastDamagedWithGetter);*/
 
@@ -241,9 +295,6 @@ extern V8Class v8Vehicle("Vehicle", v8Entity, Constructor, [](v8::Local<v8::Func
     V8::SetMethod(isolate, tpl, "getHealthDataBase64", &GetHealthData);
     V8::SetMethod(isolate, tpl, "setHealthDataBase64", &SetHealthData);
 
-    // Damage getters/setters
-    V8::SetAccessor<IVehicle, bool, &IVehicle::HasArmoredWindows>(isolate, tpl, "hasArmoredWindows");
-
     // Damage methods
     V8::SetMethod(isolate, tpl, "getPartDamageLevel", &GetPartDamageLevel);
     V8::SetMethod(isolate, tpl, "setPartDamageLevel", &SetPartDamageLevel);
@@ -266,34 +317,13 @@ extern V8Class v8Vehicle("Vehicle", v8Entity, Constructor, [](v8::Local<v8::Func
     V8::SetMethod<IVehicle, &IVehicle::SetFixed>(isolate, tpl, "repair");
     V8::SetMethod(isolate, tpl, "setWheelFixed", &SetWheelFixed);
 
-    // Script getters/setters
-    V8::SetAccessor<IVehicle, bool, &IVehicle::IsManualEngineControl, &IVehicle::SetManualEngineControl>(isolate, tpl, "manualEngineControl");
-
     // Script methods
     V8::SetMethod(isolate, tpl, "getScriptDataBase64", &GetScriptData);
     V8::SetMethod(isolate, tpl, "setScriptDataBase64", &SetScriptData);
 
-    V8::SetAccessor<IVehicle, Ref<IVehicle>, &IVehicle::GetAttached>(isolate, tpl, "attached");
-    V8::SetAccessor<IVehicle, Ref<IVehicle>, &IVehicle::GetAttachedTo>(isolate, tpl, "attachedTo");
-
-    // Train getter/setter
-    V8::SetAccessor<IVehicle, bool, &IVehicle::IsTrainMissionTrain, &IVehicle::SetTrainMissionTrain>(isolate, tpl, "isMissionTrain");
-    V8::SetAccessor<IVehicle, int8_t, &IVehicle::GetTrainTrackId, &IVehicle::SetTrainTrackId>(isolate, tpl, "trainTrackId");
-    V8::SetAccessor<IVehicle, Ref<IVehicle>, &IVehicle::GetTrainEngineId>(isolate, tpl, "trainEngineId");
+    // Train methods
     V8::SetMethod(isolate, tpl, "setTrainEngineId", &SetTrainEngineId);
-    V8::SetAccessor<IVehicle, int8_t, &IVehicle::GetTrainConfigIndex, &IVehicle::SetTrainConfigIndex>(isolate, tpl, "trainConfigIndex");
-    V8::SetAccessor<IVehicle, float, &IVehicle::GetTrainDistanceFromEngine, &IVehicle::SetTrainDistanceFromEngine>(isolate, tpl, "trainDistanceFromEngine");
-    V8::SetAccessor<IVehicle, bool, &IVehicle::IsTrainEngine, &IVehicle::SetTrainIsEngine>(isolate, tpl, "isTrainEngine");
-    V8::SetAccessor<IVehicle, bool, &IVehicle::IsTrainCaboose, &IVehicle::SetTrainIsCaboose>(isolate, tpl, "isTrainCaboose");
-    V8::SetAccessor<IVehicle, bool, &IVehicle::GetTrainDirection, &IVehicle::SetTrainDirection>(isolate, tpl, "trainDirection");
-    V8::SetAccessor<IVehicle, bool, &IVehicle::HasTrainPassengerCarriages, &IVehicle::SetTrainHasPassengerCarriages>(isolate, tpl, "trainPassengerCarriages");
-    V8::SetAccessor<IVehicle, bool, &IVehicle::GetTrainRenderDerailed, &IVehicle::SetTrainRenderDerailed>(isolate, tpl, "trainRenderDerailed");
-    V8::SetAccessor<IVehicle, bool, &IVehicle::GetTrainForceDoorsOpen, &IVehicle::SetTrainForceDoorsOpen>(isolate, tpl, "trainForceDoorsOpen");
-    V8::SetAccessor<IVehicle, float, &IVehicle::GetTrainCruiseSpeed, &IVehicle::SetTrainCruiseSpeed>(isolate, tpl, "trainCruiseSpeed");
-    V8::SetAccessor<IVehicle, int8_t, &IVehicle::GetTrainCarriageConfigIndex, &IVehicle::SetTrainCarriageConfigIndex>(isolate, tpl, "trainCarriageConfigIndex");
-    V8::SetAccessor<IVehicle, Ref<IVehicle>, &IVehicle::GetTrainLinkedToBackwardId>(isolate, tpl, "trainLinkedToBackwardId");
     V8::SetMethod(isolate, tpl, "setTrainLinkedToBackwardId", &SetTrainLinkedToBackwardId);
-    V8::SetAccessor<IVehicle, Ref<IVehicle>, &IVehicle::GetTrainLinkedToForwardId>(isolate, tpl, "trainLinkedToForwardId");
     V8::SetMethod(isolate, tpl, "setTrainLinkedToForwardId", &SetTrainLinkedToForwardId);
 
     //Heli setter
@@ -2,6 +2,7 @@
 
 #include "V8ResourceImpl.h"
 #include "V8Helpers.h"
+#include "../CNodeScriptRuntime.h"
 
 #include "cpp-sdk/events/CClientScriptEvent.h"
 #include "cpp-sdk/events/CServerScriptEvent.h"
@@ -17,51 +18,55 @@ using EventType = CEvent::Type;
 
 V8::EventHandler clientScriptEvent(
   EventType::CLIENT_SCRIPT_EVENT,
-  [](V8ResourceImpl* resource, const CEvent* e) {
+  [](V8ResourceImpl* resource, const CEvent* e) -> const std::vector<V8::EventCallback*>& {
       auto ev = static_cast<const alt::CClientScriptEvent*>(e);
-      return resource->GetRemoteHandlers(ev->GetName().ToString());
+      const auto& name = ev->GetName();
+      return resource->GetRemoteHandlers(std::string_view{ name.GetData(), name.GetSize() });
   },
-  [](V8ResourceImpl* resource, const CEvent* e, std::vector<v8::Local<v8::Value>>& args) {
+  [](V8ResourceImpl* resource, const CEvent* e, V8::EventArgs& args) {
       auto ev = static_cast<const alt::CClientScriptEvent*>(e);
 
       args.push_back(resource->GetBaseObjectOrNull(ev->GetTarget()));
-      V8Helpers::MValueArgsToV8(ev->GetArgs(), args);
+      CNodeScriptRuntime::Instance().GetArgsCache().Convert(ev->GetArgs(), args);
   });
 
 V8::EventHandler serverScriptEvent(
   EventType::SERVER_SCRIPT_EVENT,
-  [](V8ResourceImpl* resource, const CEvent* e) {
+  [](V8ResourceImpl* resource, const CEvent* e) -> const std::vector<V8::EventCallback*>& {
       auto ev = static_cast<const alt::CServerScriptEvent*>(e);
-      return resource->GetLocalHandlers(ev->GetName().ToString());
+      const auto& name = ev->GetName();
+      return resource->GetLocalHandlers(std::string_view{ name.GetData(), name.GetSize() });
   },
-  [](V8ResourceImpl* resource, const CEvent* e, std::vector<v8::Local<v8::Value>>& args) {
+  [](V8ResourceImpl* resource, const CEvent* e, V8::EventArgs& args) {
       auto ev = static_cast<const alt::CServerScriptEvent*>(e);
-      V8Helpers::MValueArgsToV8(ev->GetArgs(), args);
+      CNodeScriptRuntime::Instance().GetArgsCache().Convert(ev->GetArgs(), args);
   });
 
 V8::EventHandler colshapeEvent(
   EventType::COLSHAPE_EVENT,
-  [](V8ResourceImpl* resource, const CEvent* e) {
+  [](V8ResourceImpl* resource, const CEvent* e) -> const std::vector<V8::EventCallback*>& {
+      static const uint32_t enterId = V8::EventIds::Get("entityEnterColshape");
+      static const uint32_t leaveId = V8::EventIds::Get("entityLeaveColshape");
       auto ev = static_cast<const alt::CColShapeEvent*>(e);
 
-      if(ev->GetState()) return resource->GetLocalHandlers("entityEnterColshape");
+      if(ev->GetState()) return resource->GetLocalHandlers(enterId);
       else
-          return resource->GetLocalHandlers("entityLeaveColshape");
+          return resource->GetLocalHandlers(leaveId);
   },
-  [](V8ResourceImpl* resource, const CEvent* e, std::vector<v8::Local<v8::Value>>& args) {
+  [](V8ResourceImpl* resource, const CEvent* e, V8::EventArgs& args) {
       auto ev = static_cast<const alt::CColShapeEvent*>(e);
 
       args.push_back(resource->GetBaseObjectOrNull(ev->GetTarget()));
       args.push_back(resource->GetBaseObjectOrNull(ev->GetEntity()));
   });
 
-V8::LocalEventHandler removeEntity(EventType::REMOVE_ENTITY_EVENT, "removeEntity", [](V8ResourceImpl* resource, const CEvent* e, std::vector<v8::Local<v8::Value>>& args) {
+V8::LocalEventHandler removeEntity(EventType::REMOVE_ENTITY_EVENT, "removeEntity", [](V8ResourceImpl* resource, const CEvent* e, V8::EventArgs& args) {
     auto ev = static_cast<const alt::CRemoveEntityEvent*>(e);
 
     args.push_back(resource->GetBaseObjectOrNull(ev->GetEntity()));
 });
 
-V8::LocalEventHandler weaponDamage(EventType::WEAPON_DAMAGE_EVENT, "weaponDamage", [](V8ResourceImpl* resource, const CEvent* e, std::vector<v8::Local<v8::Value>>& args) {
+V8::LocalEventHandler weaponDamage(EventType::WEAPON_DAMAGE_EVENT, "weaponDamage", [](V8ResourceImpl* resource, const CEvent* e, V8::EventArgs& args) {
     auto ev = static_cast<const alt::CWeaponDamageEvent*>(e);
     v8::Isolate* isolate = resource->GetIsolate();
 
@@ -73,7 +78,7 @@ V8::LocalEventHandler weaponDamage(EventType::WEAPON_DAMAGE_EVENT, "weaponDamage
     args.push_back(V8::JSValue(static_cast<int8_t>(ev->GetBodyPart())));
 });
 
-V8::LocalEventHandler explosionEvent(EventType::EXPLOSION_EVENT, "explosion", [](V8ResourceImpl* resource, const CEvent* e, std::vector<v8::Local<v8::Value>>& args) {
+V8::LocalEventHandler explosionEvent(EventType::EXPLOSION_EVENT, "explosion", [](V8ResourceImpl* resource, const CEvent* e, V8::EventArgs& args) {
     auto ev = static_cast<const alt::CExplosionEvent*>(e);
     v8::Isolate* isolate = resource->GetIsolate();
 
@@ -84,7 +89,7 @@ V8::LocalEventHandler explosionEvent(EventType::EXPLOSION_EVENT, "explosion", []
     args.push_back(resource->GetBaseObjectOrNull(ev->GetTarget()));
 });
 
-V8::LocalEventHandler fireEvent(EventType::FIRE_EVENT, "startFire", [](V8ResourceImpl* resource, const CEvent* e, std::vector<v8::Local<v8::Value>>& args) {
+V8::LocalEventHandler fireEvent(EventType::FIRE_EVENT, "startFire", [](V8ResourceImpl* resource, const CEvent* e, V8::EventArgs& args) {
     auto ev = static_cast<const alt::CFireEvent*>(e);
     v8::Isolate* isolate = resource->GetIsolate();
 
@@ -104,7 +109,7 @@ V8::LocalEventHandler fireEvent(EventType::FIRE_EVENT, "startFire", [](V8Resourc
     args.push_back(v8fires);
 });
 
-V8::LocalEventHandler startProjectileEvent(EventType::START_PROJECTILE_EVENT, "startProjectile", [](V8ResourceImpl* resource, const CEvent* e, std::vector<v8::Local<v8::Value>>& args) {
+V8::LocalEventHandler startProjectileEvent(EventType::START_PROJECTILE_EVENT, "startProjectile", [](V8ResourceImpl* resource, const CEvent* e, V8::EventArgs& args) {
     auto ev = static_cast<const alt::CStartProjectileEvent*>(e);
     v8::Isolate* isolate = resource->GetIsolate();
 
@@ -115,22 +120,22 @@ V8::LocalEventHandler startProjectileEvent(EventType::START_PROJECTILE_EVENT, "s
     args.push_back(V8::JSValue(ev->GetWeaponHash()));
 });
 
-V8::LocalEventHandler resourceStart(EventType::RESOURCE_START, "anyResourceStart", [](V8ResourceImpl* resource, const CEvent* e, std::vector<v8::Local<v8::Value>>& args) {
+V8::LocalEventHandler resourceStart(EventType::RESOURCE_START, "anyResourceStart", [](V8ResourceImpl* resource, const CEvent* e, V8::EventArgs& args) {
     auto ev = static_cast<const alt::CResourceStartEvent*>(e);
     args.push_back(V8::JSValue(ev->GetResource()->GetName()));
 });
 
-V8::LocalEventHandler resourceStop(EventType::RESOURCE_STOP, "anyResourceStop", [](V8ResourceImpl* resource, const CEvent* e, std::vector<v8::Local<v8::Value>>& args) {
+V8::LocalEventHandler resourceStop(EventType::RESOURCE_STOP, "anyResourceStop", [](V8ResourceImpl* resource, const CEvent* e, V8::EventArgs& args) {
     auto ev = static_cast<const alt::CResourceStopEvent*>(e);
     args.push_back(V8::JSValue(ev->GetResource()->GetName()));
 });
 
-V8::LocalEventHandler resourceError(EventType::RESOURCE_ERROR, "anyResourceError", [](V8ResourceImpl* resource, const CEvent* e, std::vector<v8::Local<v8::Value>>& args) {
+V8::LocalEventHandler resourceError(EventType::RESOURCE_ERROR, "anyResourceError", [](V8ResourceImpl* resource, const CEvent* e, V8::EventArgs& args) {
     auto ev = static_cast<const alt::CResourceErrorEvent*>(e);
     args.push_back(V8::JSValue(ev->GetResource()->GetName()));
 });
 
-V8::LocalEventHandler syncedMetaChange(EventType::SYNCED_META_CHANGE, "syncedMetaChange", [](V8ResourceImpl* resource, const CEvent* e, std::vector<v8::Local<v8::Value>>& args) {
+V8::LocalEventHandler syncedMetaChange(EventType::SYNCED_META_CHANGE, "syncedMetaChange", [](V8ResourceImpl* resource, const CEvent* e, V8::EventArgs& args) {
     auto ev = static_cast<const alt::CSyncedMetaDataChangeEvent*>(e);
 
     args.push_back(resource->GetBaseObjectOrNull(ev->GetTarget()));
@@ -140,7 +145,7 @@ V8::LocalEventHandler syncedMetaChange(EventType::SYNCED_META_CHANGE, "syncedMet
 });
 
 V8::LocalEventHandler
-  streamSyncedMetaChange(EventType::STREAM_SYNCED_META_CHANGE, "streamSyncedMetaChange", [](V8ResourceImpl* resource, const CEvent* e, std::vector<v8::Local<v8::Value>>& args) {
+  streamSyncedMetaChange(EventType::STREAM_SYNCED_META_CHANGE, "streamSyncedMetaChange", [](V8ResourceImpl* resource, const CEvent* e, V8::EventArgs& args) {
       auto ev = static_cast<const alt::CStreamSyncedMetaDataChangeEvent*>(e);
 
       args.push_back(resource->GetBaseObjectOrNull(ev->GetTarget()));
@@ -149,7 +154,7 @@ V8::LocalEventHandler
       args.push_back(V8Helpers::MValueToV8(ev->GetOldVal()));
   });
 
-V8::LocalEventHandler globalMetaChange(EventType::GLOBAL_META_CHANGE, "globalMetaChange", [](V8ResourceImpl* resource, const CEvent* e, std::vector<v8::Local<v8::Value>>& args) {
+V8::LocalEventHandler globalMetaChange(EventType::GLOBAL_META_CHANGE, "globalMetaChange", [](V8ResourceImpl* resource, const CEvent* e, V8::EventArgs& args) {
     auto ev = static_cast<const alt::CGlobalMetaDataChangeEvent*>(e);
 
     args.push_back(V8::JSValue(ev->GetKey()));
@@ -158,7 +163,7 @@ V8::LocalEventHandler globalMetaChange(EventType::GLOBAL_META_CHANGE, "globalMet
 });
 
 V8::LocalEventHandler
-  globalSyncedMetaChange(EventType::GLOBAL_SYNCED_META_CHANGE, "globalSyncedMetaChange", [](V8ResourceImpl* resource, const CEvent* e, std::vector<v8::Local<v8::Value>>& args) {
+  globalSyncedMetaChange(EventType::GLOBAL_SYNCED_META_CHANGE, "globalSyncedMetaChange", [](V8ResourceImpl* resource, const CEvent* e, V8::EventArgs& args) {
       auto ev = static_cast<const alt::CGlobalSyncedMetaDataChangeEvent*>(e);
 
       args.push_back(V8::JSValue(ev->GetKey()));
@@ -16,19 +16,19 @@
 using alt::CEvent;
 using EventType = CEvent::Type;
 
-V8::LocalEventHandler playerConnect(EventType::PLAYER_CONNECT, "playerConnect", [](V8ResourceImpl* resource, const CEvent* e, std::vector<v8::Local<v8::Value>>& args) {
+V8::LocalEventHandler playerConnect(EventType::PLAYER_CONNECT, "playerConnect", [](V8ResourceImpl* resource, const CEvent* e, V8::EventArgs& args) {
     auto ev = static_cast<const alt::CPlayerConnectEvent*>(e);
     args.push_back(resource->GetBaseObjectOrNull(ev->GetTarget()));
 });
 
-V8::LocalEventHandler playerDisconnect(EventType::PLAYER_DISCONNECT, "playerDisconnect", [](V8ResourceImpl* resource, const CEvent* e, std::vector<v8::Local<v8::Value>>& args) {
+V8::LocalEventHandler playerDisconnect(EventType::PLAYER_DISCONNECT, "playerDisconnect", [](V8ResourceImpl* resource, const CEvent* e, V8::EventArgs& args) {
     auto ev = static_cast<const alt::CPlayerDisconnectEvent*>(e);
 
     args.push_back(resource->GetBaseObjectOrNull(ev->GetTarget()));
     args.push_back(V8::JSValue(ev->GetReason()));
 });
 
-V8::LocalEventHandler playerDamage(EventType::PLAYER_DAMAGE, "playerDamage", [](V8ResourceImpl* resource, const CEvent* e, std::vector<v8::Local<v8::Value>>& args) {
+V8::LocalEventHandler playerDamage(EventType::PLAYER_DAMAGE, "playerDamage", [](V8ResourceImpl* resource, const CEvent* e, V8::EventArgs& args) {
     auto ev = static_cast<const alt::CPlayerDamageEvent*>(e);
     v8::Isolate* isolate = resource->GetIsolate();
 
@@ -39,7 +39,7 @@ V8::LocalEventHandler playerDamage(EventType::PLAYER_DAMAGE, "playerDamage", [](
     args.push_back(V8::JSValue(ev->GetWeapon()));
 });
 
-V8::LocalEventHandler playerDeath(EventType::PLAYER_DEATH, "playerDeath", [](V8ResourceImpl* resource, const CEvent* e, std::vector<v8::Local<v8::Value>>& args) {
+V8::LocalEventHandler playerDeath(EventType::PLAYER_DEATH, "playerDeath", [](V8ResourceImpl* resource, const CEvent* e, V8::EventArgs& args) {
     auto ev = static_cast<const alt::CPlayerDeathEvent*>(e);
     v8::Isolate* isolate = resource->GetIsolate();
 
@@ -50,7 +50,7 @@ V8::LocalEventHandler playerDeath(EventType::PLAYER_DEATH, "playerDeath", [](V8R
 
 V8::LocalEventHandler playerEnterVehicle(EventType::PLAYER_ENTER_VEHICLE,
                                          "playerEnteredVehicle",  // TODO: change name for consistency
-                                         [](V8ResourceImpl* resource, const CEvent* e, std::vector<v8::Local<v8::Value>>& args) {
+                                         [](V8ResourceImpl* resource, const CEvent* e, V8::EventArgs& args) {
                                              auto ev = static_cast<const alt::CPlayerEnterVehicleEvent*>(e);
 
                                              args.push_back(resource->GetBaseObjectOrNull(ev->GetPlayer()));
@@ -60,7 +60,7 @@ V8::LocalEventHandler playerEnterVehicle(EventType::PLAYER_ENTER_VEHICLE,
 
 V8::LocalEventHandler playerEnteringVehicle(EventType::PLAYER_ENTERING_VEHICLE,
                                             "playerEnteringVehicle",  // TODO: don't change names, it's okay
-                                            [](V8ResourceImpl* resource, const CEvent* e, std::vector<v8::Local<v8::Value>>& args) {
+                                            [](V8ResourceImpl* resource, const CEvent* e, V8::EventArgs& args) {
                                                 auto ev = static_cast<const alt::CPlayerEnteringVehicleEvent*>(e);
 
                                                 args.push_back(resource->GetBaseObjectOrNull(ev->GetPlayer()));
@@ -70,7 +70,7 @@ V8::LocalEventHandler playerEnteringVehicle(EventType::PLAYER_ENTERING_VEHICLE,
 
 V8::LocalEventHandler playerLeaveVehicle(EventType::PLAYER_LEAVE_VEHICLE,
                                          "playerLeftVehicle",  // TODO: change name for consistency
-                                         [](V8ResourceImpl* resource, const CEvent* e, std::vector<v8::Local<v8::Value>>& args) {
+                                         [](V8ResourceImpl* resource, const CEvent* e, V8::EventArgs& args) {
                                              auto ev = static_cast<const alt::CPlayerLeaveVehicleEvent*>(e);
 
                                              args.push_back(resource->GetBaseObjectOrNull(ev->GetPlayer()));
@@ -80,7 +80,7 @@ V8::LocalEventHandler playerLeaveVehicle(EventType::PLAYER_LEAVE_VEHICLE,
 
 V8::LocalEventHandler playerChangeVehicleSeat(EventType::PLAYER_CHANGE_VEHICLE_SEAT,
                                               "playerChangedVehicleSeat",  // TODO: change name for consistency
-                                              [](V8ResourceImpl* resource, const CEvent* e, std::vector<v8::Local<v8::Value>>& args) {
+                                              [](V8ResourceImpl* resource, const CEvent* e, V8::EventArgs& args) {
                                                   auto ev = static_cast<const alt::CPlayerChangeVehicleSeatEvent*>(e);
 
                                                   args.push_back(resource->GetBaseObjectOrNull(ev->GetPlayer()));
@@ -89,7 +89,7 @@ V8::LocalEventHandler playerChangeVehicleSeat(EventType::PLAYER_CHANGE_VEHICLE_S
                                                   args.push_back(V8::JSValue(ev->GetNewSeat()));
                                               });
 
-V8::LocalEventHandler playerWeaponChange(EventType::PLAYER_WEAPON_CHANGE, "playerWeaponChange", [](V8ResourceImpl* resource, const CEvent* e, std::vector<v8::Local<v8::Value>>& args) {
+V8::LocalEventHandler playerWeaponChange(EventType::PLAYER_WEAPON_CHANGE, "playerWeaponChange", [](V8ResourceImpl* resource, const CEvent* e, V8::EventArgs& args) {
     auto ev = static_cast<const alt::CPlayerWeaponChangeEvent*>(e);
 
     args.push_back(resource->GetBaseObjectOrNull(ev->GetTarget()));
@@ -10,26 +10,26 @@
 using alt::CEvent;
 using EventType = CEvent::Type;
 
-V8::LocalEventHandler vehicleDestroy(EventType::VEHICLE_DESTROY, "vehicleDestroy", [](V8ResourceImpl* resource, const CEvent* e, std::vector<v8::Local<v8::Value>>& args) {
+V8::LocalEventHandler vehicleDestroy(EventType::VEHICLE_DESTROY, "vehicleDestroy", [](V8ResourceImpl* resource, const CEvent* e, V8::EventArgs& args) {
     auto ev = static_cast<const alt::CVehicleDestroyEvent*>(e);
     args.push_back(resource->GetBaseObjectOrNull(ev->GetTarget()));
 });
 
-V8::LocalEventHandler vehicleAttach(EventType::VEHICLE_ATTACH, "vehicleAttach", [](V8ResourceImpl* resource, const CEvent* e, std::vector<v8::Local<v8::Value>>& args) {
+V8::LocalEventHandler vehicleAttach(EventType::VEHICLE_ATTACH, "vehicleAttach", [](V8ResourceImpl* resource, const CEvent* e, V8::EventArgs& args) {
     auto ev = static_cast<const alt::CVehicleAttachEvent*>(e);
 
     args.push_back(resource->GetBaseObjectOrNull(ev->GetTarget()));
     args.push_back(resource->GetBaseObjectOrNull(ev->GetAttached()));
 });
 
-V8::LocalEventHandler vehicleDetach(EventType::VEHICLE_DETACH, "vehicleDetach", [](V8ResourceImpl* resource, const CEvent* e, std::vector<v8::Local<v8::Value>>& args) {
+V8::LocalEventHandler vehicleDetach(EventType::VEHICLE_DETACH, "vehicleDetach", [](V8ResourceImpl* resource, const CEvent* e, V8::EventArgs& args) {
     auto ev = static_cast<const alt::CVehicleDetachEvent*>(e);
 
     args.push_back(resource->GetBaseObjectOrNull(ev->GetTarget()));
     args.push_back(resource->GetBaseObjectOrNull(ev->GetDetached()));
 });
 
-V8::LocalEventHandler netOwnerChange(EventType::NETOWNER_CHANGE, "netOwnerChange", [](V8ResourceImpl* resource, const CEvent* e, std::vector<v8::Local<v8::Value>>& args) {
+V8::LocalEventHandler netOwnerChange(EventType::NETOWNER_CHANGE, "netOwnerChange", [](V8ResourceImpl* resource, const CEvent* e, V8::EventArgs& args) {
     auto ev = static_cast<const alt::CNetOwnerChangeEvent*>(e);
 
     args.push_back(resource->GetBaseObjectOrNull(ev->GetTarget()));
@@ -37,7 +37,7 @@ V8::LocalEventHandler netOwnerChange(EventType::NETOWNER_CHANGE, "netOwnerChange
     args.push_back(resource->GetBaseObjectOrNull(ev->GetOldOwner()));
 });
 
-V8::LocalEventHandler vehicleDamage(EventType::VEHICLE_DAMAGE, "vehicleDamage", [](V8ResourceImpl* resource, const CEvent* e, std::vector<v8::Local<v8::Value>>& args) {
+V8::LocalEventHandler vehicleDamage(EventType::VEHICLE_DAMAGE, "vehicleDamage", [](V8ResourceImpl* resource, const CEvent* e, V8::EventArgs& args) {
     auto ev = static_cast<const alt::CVehicleDamageEvent*>(e);
     auto isolate = resource->GetIsolate();
 
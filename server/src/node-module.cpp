@@ -2,6 +2,7 @@
 
 #include "V8Module.h"
 #include "CNodeScriptRuntime.h"
+#include "Benchmarks.h"
 
 /*static void NodeStop()
 {
@@ -66,14 +67,50 @@ static void CommandHandler(alt::Array<alt::StringView> args, void* userData)
         Log::Colored << "~y~Options:" << Log::Endl;
         Log::Colored << "  ~ly~--help    ~w~- this message." << Log::Endl;
         Log::Colored << "  ~ly~--version ~w~- version info." << Log::Endl;
+        V8Helpers::PrintSharedCommandHelp();
+        Log::Colored << "  ~ly~--loop-polling [ready|all] ~w~- whether resources are only ticked when their loop or timers have work." << Log::Endl;
+        Log::Colored << "~y~Weak entity wrappers are allowed with ~ly~js-module-weak-entities: true ~w~in server.cfg." << Log::Endl;
     }
-    else
+    else if(args.GetSize() > 0 && args[0] == "--loop-polling")
+    {
+        std::string_view arg = (args.GetSize() > 1) ? std::string_view{ args[1].GetData(), args[1].GetSize() } : std::string_view{};
+
+        if(arg == "ready" || arg == "all")
+        {
+            CLoopPoller::SetEnabled(arg == "ready");
+            Log::Colored << "~ly~" << (arg == "ready" ? "Only resources with work are ticked now" : "All resources are ticked now") << Log::Endl;
+        }
+        else
+        {
+            Log::Colored << "~y~Usage: ~w~js-module --loop-polling [ready|all]" << Log::Endl;
+        }
+    }
+    else if(!V8Helpers::HandleSharedCommand(args))
     {
         Log::Colored << "~y~Usage: ~w~js-module [options]" << Log::Endl;
         Log::Colored << "  Use: ~ly~\"js-module --help\" ~w~for more info" << Log::Endl;
     }
 }
 
+static void HeapCommand(alt::Array<alt::StringView>, void* runtime)
+{
+    auto nodeRuntime = static_cast<CNodeScriptRuntime*>(runtime);
+
+    v8::HeapStatistics heapStats;
+    nodeRuntime->GetIsolate()->GetHeapStatistics(&heapStats);
+
+    Log::Info << "================ Heap benchmark info =================" << Log::Endl;
+    Log::Info << "used_heap_size = " << heapStats.used_heap_size() / 1024 << " KB" << Log::Endl;
+    Log::Info << "total_heap_size = " << heapStats.total_heap_size() / 1024 << " KB" << Log::Endl;
+    Log::Info << "heap_size_limit = " << heapStats.heap_size_limit() / 1024 << " KB" << Log::Endl;
+    Log::Info << "external_memory = " << heapStats.external_memory() / 1024 << " KB" << Log::Endl;
+    for(auto resource : nodeRuntime->GetResources())
+    {
+        resource->EntityBenchmark();
+    }
+    Log::Info << "======================================================" << Log::Endl;
+}
+
 static void TimersCommand(alt::Array<alt::StringView>, void* runtime)
 {
     auto resources = static_cast<CNodeScriptRuntime*>(runtime)->GetResources();
@@ -85,6 +122,71 @@ static void TimersCommand(alt::Array<alt::StringView>, void* runtime)
     Log::Info << "======================================================" << Log::Endl;
 }
 
+static void LoopsCommand(alt::Array<alt::StringView>, void* runtime)
+{
+    auto resources = static_cast<CNodeScriptRuntime*>(runtime)->GetResources();
+    if(!V8::EventStats::IsEnabled()) Log::Info << "Tick times are only measured while event stats are enabled, use \"eventstats on\" to enable it" << Log::Endl;
+
+    Log::Info << "================ Loop info =================" << Log::Endl;
+    Log::Info << "Loop polling: " << (CLoopPoller::IsEnabled() ? "ready" : "all") << ", " << resources.size() << " resources" << Log::Endl;
+    for(auto resource : resources)
+    {
+        resource->LoopBenchmark();
+    }
+    Log::Info << "======================================================" << Log::Endl;
+}
+
+static void PlatformCommand(alt::Array<alt::StringView>, void* runtime)
+{
+    auto nodeRuntime = static_cast<CNodeScriptRuntime*>(runtime);
+    CNodePlatform* platform = nodeRuntime->GetPlatform();
+
+    CNodePlatform::QueueDepth worker = platform->GetWorkerQueueDepth();
+    CNodePlatform::QueueDepth foreground = platform->GetForegroundQueueDepth(nodeRuntime->GetIsolate());
+
+    Log::Info << "================ Platform info =================" << Log::Endl;
+    Log::Info << "worker threads = " << platform->NumberOfWorkerThreads() << Log::Endl;
+    Log::Info << "worker queue = " << worker.tasks << " tasks, " << worker.delayedTasks << " delayed" << Log::Endl;
+    Log::Info << "foreground queue = " << foreground.tasks << " tasks, " << foreground.delayedTasks << " delayed" << Log::Endl;
+    Log::Info << "======================================================" << Log::Endl;
+}
+
+static void EventStatsCommand(alt::Array<alt::StringView> args, void* runtime)
+{
+    std::string_view arg = (args.GetSize() > 0) ? std::string_view{ args[0].GetData(), args[0].GetSize() } : std::string_view{};
+    auto resources = static_cast<CNodeScriptRuntime*>(runtime)->GetResources();
+
+    if(arg == "on" || arg == "off")
+    {
+        V8::EventStats::SetEnabled(arg == "on");
+        Log::Info << "Event stats collection " << (arg == "on" ? "enabled" : "disabled") << Log::Endl;
+    }
+    else if(arg == "reset")
+    {
+        for(auto resource : resources) resource->GetEventStats().Reset();
+        Log::Info << "Event stats reset" << Log::Endl;
+    }
+    else
+    {
+        if(!V8::EventStats::IsEnabled()) Log::Info << "Event stats collection is disabled, use \"eventstats on\" to enable it" << Log::Endl;
+
+        Log::Info << "================ Event stats =================" << Log::Endl;
+        for(auto resource : resources)
+        {
+            resource->DumpEventStats();
+        }
+        Log::Info << "======================================================" << Log::Endl;
+    }
+}
+
+static void BenchCommand(alt::Array<alt::StringView> args, void* runtime)
+{
+    std::string_view name = (args.GetSize() > 0) ? std::string_view{ args[0].GetData(), args[0].GetSize() } : std::string_view{};
+    uint32_t count = (args.GetSize() > 1) ? (uint32_t)std::strtoul(std::string{ args[1].GetData(), args[1].GetSize() }.c_str(), nullptr, 10) : 0;
+
+    if(!Benchmarks::Run(static_cast<CNodeScriptRuntime*>(runtime), name, count)) Benchmarks::PrintHelp();
+}
+
 EXPORT uint32_t GetSDKVersion()
 {
     return alt::ICore::SDK_VERSION;
@@ -99,7 +201,12 @@ EXPORT bool altMain(alt::ICore* _core)
 
     apiCore.RegisterScriptRuntime("js", &runtime);
     apiCore.SubscribeCommand("js-module", &CommandHandler);
-    apiCore.SubscribeCommand("timers", &TimersCommand);
+    apiCore.SubscribeCommand("heap", &HeapCommand, &runtime);
+    apiCore.SubscribeCommand("timers", &TimersCommand, &runtime);
+    apiCore.SubscribeCommand("eventstats", &EventStatsCommand, &runtime);
+    apiCore.SubscribeCommand("loops", &LoopsCommand, &runtime);
+    apiCore.SubscribeCommand("platform", &PlatformCommand, &runtime);
+    apiCore.SubscribeCommand("bench", &BenchCommand, &runtime);
 
     return true;
 }
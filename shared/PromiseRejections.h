@@ -25,6 +25,11 @@ namespace V8
         void HandlerAdded(V8ResourceImpl* resource, v8::PromiseRejectMessage& data);
         void ProcessQueue(V8ResourceImpl* resource);
 
+        bool IsEmpty() const
+        {
+            return queue.empty();
+        }
+
     private:
         std::vector<std::unique_ptr<PromiseRejection>> queue;
     };
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <unordered_map>
+#include <vector>
+
+#include <v8.h>
+
+#include "cpp-sdk/objects/IBaseObject.h"
+#include "V8Entity.h"
+
+namespace V8
+{
+    // Base objects of one type, kept up to date from OnCreateBaseObject/OnRemoveBaseObject
+    // once the pool was requested for the first time. Scripts get a frozen array of it,
+    // which is only rebuilt after the pool changed. With weak wrappers the array is only
+    // kept while scripts reference it, it would otherwise keep every wrapper alive
+    class BaseObjectPool
+    {
+    public:
+        bool IsInitialized() const
+        {
+            return initialized;
+        }
+
+        template<class T>
+        void Init(const alt::Array<alt::Ref<T>>& all)
+        {
+            initialized = true;
+            for(uint32_t i = 0; i < all.GetSize(); ++i) Add(all[i].Get());
+        }
+
+        void Add(alt::IBaseObject* handle)
+        {
+            if(!initialized || !handle || indices.count(handle) != 0) return;
+
+            indices.insert({ handle, uint32_t(handles.size()) });
+            handles.push_back(handle);
+            dirty = true;
+        }
+
+        // Swaps the last object into the slot of the removed one
+        void Remove(alt::IBaseObject* handle)
+        {
+            auto it = indices.find(handle);
+            if(it == indices.end()) return;
+
+            uint32_t index = it->second;
+            indices.erase(it);
+
+            if(index != handles.size() - 1)
+            {
+                handles[index] = handles.back();
+                indices[handles[index]] = index;
+            }
+
+            handles.pop_back();
+            dirty = true;
+        }
+
+        template<class Fn>
+        v8::Local<v8::Array> GetArray(v8::Isolate* isolate, v8::Local<v8::Context> ctx, Fn&& toJS)
+        {
+            if(!dirty && !array.IsEmpty()) return array.Get(isolate);
+
+            dirty = false;
+
+            std::vector<v8::Local<v8::Value>> values;
+            values.reserve(handles.size());
+            for(auto handle : handles) values.push_back(toJS(handle));
+
+            v8::Local<v8::Array> arr = v8::Array::New(isolate, values.data(), values.size());
+            arr->SetIntegrityLevel(ctx, v8::IntegrityLevel::kFrozen);
+
+            array.Reset(isolate, arr);
+            if(V8Entity::IsWeakEnabled()) array.SetWeak();
+            return arr;
+        }
+
+    private:
+        std::vector<alt::IBaseObject*> handles;
+        std::unordered_map<alt::IBaseObject*, uint32_t> indices;
+        v8::UniquePersistent<v8::Array> array;
+        bool initialized = false;
+        bool dirty = true;
+    };
+}  // namespace V8
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <algorithm>
+
 #include "V8Helpers.h"
 #include "V8ResourceImpl.h"
 
@@ -20,6 +22,18 @@
         (_this->*setter)(type(_val));                                                                                                        \
     }
 
+// Accessors registered through V8::SetAccessor<...> carry an AccessorSignature, so V8 has already checked
+// the receiver is an entity wrapper. The handle is borrowed, which is fine as long as it's only used
+// for the synchronous getter or setter call
+#define V8_GET_THIS_BORROWED_BASE_OBJECT(val, type)             \
+    type* val;                                                  \
+    {                                                           \
+        V8Entity* __val = V8Entity::GetUnchecked(info.This());  \
+        V8_CHECK(__val, "baseobject is invalid");               \
+        val = __val->GetHandleBorrowed<type>();                 \
+        V8_CHECK(val, "baseobject is not of type " #type);      \
+    }
+
 namespace V8
 {
     namespace detail
@@ -71,16 +85,16 @@ namespace V8
         static void WrapGetter(v8::Local<v8::String>, const v8::PropertyCallbackInfo<v8::Value>& info)
         {
             V8_GET_ISOLATE();
-            V8_GET_THIS_BASE_OBJECT(_this, T);
-            CallGetter<T>(info, _this.Get(), Getter);
+            V8_GET_THIS_BORROWED_BASE_OBJECT(_this, T);
+            CallGetter<T>(info, _this, Getter);
         }
 
         template<class T, class U, void (T::*Setter)(U)>
         static void WrapSetter(v8::Local<v8::String>, v8::Local<v8::Value> value, const v8::PropertyCallbackInfo<void>& info)
         {
             V8_GET_ISOLATE();
-            V8_GET_THIS_BASE_OBJECT(_this, T);
-            CallSetter<T>(info, value, _this.Get(), Setter);
+            V8_GET_THIS_BORROWED_BASE_OBJECT(_this, T);
+            CallSetter<T>(info, value, _this, Setter);
         }
 
         template<class T, void (T::*Method)()>
@@ -90,18 +104,74 @@ namespace V8
             V8_GET_THIS_BASE_OBJECT(_this, T);
             (_this.Get()->*Method)();
         }
+
+        inline void SetCheckedAccessor(v8::Isolate* isolate, v8::Local<v8::FunctionTemplate> tpl, const char* name, v8::AccessorGetterCallback getter, v8::AccessorSetterCallback setter)
+        {
+            tpl->PrototypeTemplate()->SetAccessor(v8::String::NewFromUtf8(isolate, name, v8::NewStringType::kInternalized).ToLocalChecked(),
+                                                  getter,
+                                                  setter,
+                                                  v8::Local<v8::Value>(),
+                                                  v8::AccessControl::DEFAULT,
+                                                  setter != nullptr ? v8::PropertyAttribute::None : v8::PropertyAttribute::ReadOnly,
+                                                  v8::AccessorSignature::New(isolate, tpl));
+        }
     }  // namespace detail
 
+    // Entry of a property table, built with V8_PROPERTY or from plain accessor callbacks
+    struct Property
+    {
+        const char* name;
+        v8::AccessorGetterCallback getter;
+        v8::AccessorSetterCallback setter;
+    };
+
+    namespace detail
+    {
+        template<class T, class U, U (T::*Getter)() const>
+        constexpr Property MakeProperty(const char* name)
+        {
+            return { name, &WrapGetter<T, U, Getter>, nullptr };
+        }
+
+        template<class T, class U, U (T::*Getter)() const, void (T::*Setter)(U)>
+        constexpr Property MakeProperty(const char* name)
+        {
+            return { name, &WrapGetter<T, U, Getter>, &WrapSetter<T, U, Setter> };
+        }
+    }  // namespace detail
+
+    // V8_PROPERTY("name", T, U, &T::Getter[, &T::Setter])
+#define V8_PROPERTY(name, T, U, ...) V8::detail::MakeProperty<T, U, __VA_ARGS__>(name)
+
+    // Registers a whole constexpr table in one pass, sharing the prototype template and the receiver signature
+    template<size_t N>
+    inline void SetAccessors(v8::Isolate* isolate, v8::Local<v8::FunctionTemplate> tpl, const Property (&properties)[N])
+    {
+        v8::Local<v8::ObjectTemplate> proto = tpl->PrototypeTemplate();
+        v8::Local<v8::AccessorSignature> signature = v8::AccessorSignature::New(isolate, tpl);
+
+        for(const Property& property : properties)
+        {
+            proto->SetAccessor(v8::String::NewFromUtf8(isolate, property.name, v8::NewStringType::kInternalized).ToLocalChecked(),
+                               property.getter,
+                               property.setter,
+                               v8::Local<v8::Value>(),
+                               v8::AccessControl::DEFAULT,
+                               property.setter != nullptr ? v8::PropertyAttribute::None : v8::PropertyAttribute::ReadOnly,
+                               signature);
+        }
+    }
+
     template<class T, class U, U (T::*Getter)() const>
     inline void SetAccessor(v8::Isolate* isolate, v8::Local<v8::FunctionTemplate> tpl, const char* name)
     {
-        V8::SetAccessor(isolate, tpl, name, &V8::detail::WrapGetter<T, U, Getter>, nullptr);
+        V8::detail::SetCheckedAccessor(isolate, tpl, name, &V8::detail::WrapGetter<T, U, Getter>, nullptr);
     }
 
     template<class T, class U, U (T::*Getter)() const, void (T::*Setter)(U)>
     inline void SetAccessor(v8::Isolate* isolate, v8::Local<v8::FunctionTemplate> tpl, const char* name)
     {
-        V8::SetAccessor(isolate, tpl, name, V8::detail::WrapGetter<T, U, Getter>, V8::detail::WrapSetter<T, U, Setter>);
+        V8::detail::SetCheckedAccessor(isolate, tpl, name, V8::detail::WrapGetter<T, U, Getter>, V8::detail::WrapSetter<T, U, Setter>);
     }
 
     template<class T, void (T::*Method)()>
@@ -109,4 +179,63 @@ namespace V8
     {
         V8::SetMethod(isolate, tpl, name, V8::detail::WrapMethod<T, Method>);
     }
+
+    // Snapshots write a value of every entity of a pool into a caller provided typed array in one call,
+    // instead of reading it through each wrapper. They return the number of entities in the pool,
+    // the ones that don't fit into the array are skipped so the caller can grow it and retry
+    template<class Elem, uint32_t Components, class T, class Fn>
+    inline void WriteSnapshot(const v8::FunctionCallbackInfo<v8::Value>& info, const alt::Array<alt::Ref<T>>& all, bool (v8::Value::*isType)() const, const char* typeName, Fn&& write)
+    {
+        V8_GET_ISOLATE();
+        V8_CHECK_ARGS_LEN(1);
+        V8_CHECK(((*info[0]).*isType)(), std::string("Argument 1 must be a ") + typeName);
+
+        v8::Local<v8::TypedArray> arr = info[0].As<v8::TypedArray>();
+        Elem* out = static_cast<Elem*>(V8::GetTypedArrayData(arr));
+
+        size_t count = std::min<size_t>(all.GetSize(), arr->Length() / Components);
+        for(size_t i = 0; i < count; ++i) write(all[i].Get(), out + i * Components);
+
+        V8_RETURN_UINT(all.GetSize());
+    }
+
+    // Packed x, y, z into a Float32Array
+    template<class T>
+    inline void SnapshotPositions(const v8::FunctionCallbackInfo<v8::Value>& info, const alt::Array<alt::Ref<T>>& all)
+    {
+        WriteSnapshot<float, 3>(info, all, &v8::Value::IsFloat32Array, "Float32Array", [](T* entity, float* out) {
+            alt::Vector3f pos = entity->GetPosition();
+            out[0] = pos[0];
+            out[1] = pos[1];
+            out[2] = pos[2];
+        });
+    }
+
+    // Packed x, y, z into a Float32Array
+    template<class T>
+    inline void SnapshotRotations(const v8::FunctionCallbackInfo<v8::Value>& info, const alt::Array<alt::Ref<T>>& all)
+    {
+        WriteSnapshot<float, 3>(info, all, &v8::Value::IsFloat32Array, "Float32Array", [](T* entity, float* out) {
+            alt::Vector3f rot = entity->GetRotation();
+            out[0] = rot[0];
+            out[1] = rot[1];
+            out[2] = rot[2];
+        });
+    }
+
+    // Uint16Array
+    template<class T>
+    inline void SnapshotIds(const v8::FunctionCallbackInfo<v8::Value>& info, const alt::Array<alt::Ref<T>>& all)
+    {
+        WriteSnapshot<uint16_t, 1>(info, all, &v8::Value::IsUint16Array, "Uint16Array", [](T* entity, uint16_t* out) { *out = entity->GetID(); });
+    }
+
+#ifdef ALT_SERVER_API
+    // Int32Array
+    template<class T>
+    inline void SnapshotDimensions(const v8::FunctionCallbackInfo<v8::Value>& info, const alt::Array<alt::Ref<T>>& all)
+    {
+        WriteSnapshot<int32_t, 1>(info, all, &v8::Value::IsInt32Array, "Int32Array", [](T* entity, int32_t* out) { *out = entity->GetDimension(); });
+    }
+#endif  // ALT_SERVER_API
 }  // namespace V8
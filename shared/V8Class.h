@@ -14,7 +14,22 @@ class V8Class
     std::string name;
     v8::FunctionCallback constructor;
     InitCallback initCb;
+    // Applied to the templates of all child classes, for things Inherit doesn't copy like interceptors
+    InitCallback inheritedInitCb;
     std::unordered_map<v8::Isolate*, v8::Persistent<v8::FunctionTemplate, v8::CopyablePersistentTraits<v8::FunctionTemplate>>> tplMap;
+    // Template of the first isolate the class was loaded in, the main one, which then skips the map lookup
+    v8::Isolate* mainIsolate = nullptr;
+    v8::Persistent<v8::FunctionTemplate, v8::CopyablePersistentTraits<v8::FunctionTemplate>> mainTpl;
+
+    v8::Local<v8::FunctionTemplate> FindTemplate(v8::Isolate* isolate)
+    {
+        if(isolate == mainIsolate) return mainTpl.Get(isolate);
+
+        auto it = tplMap.find(isolate);
+        if(it == tplMap.end()) return v8::Local<v8::FunctionTemplate>();
+
+        return it->second.Get(isolate);
+    }
 
 public:
     static auto& All()
@@ -53,7 +68,7 @@ public:
     {
         v8::Isolate* isolate = v8::Isolate::GetCurrent();
 
-        v8::Local<v8::FunctionTemplate> _tpl = tplMap.at(isolate).Get(isolate);
+        v8::Local<v8::FunctionTemplate> _tpl = GetTemplate(isolate);
         v8::Local<v8::Object> obj = _tpl->InstanceTemplate()->NewInstance(ctx).ToLocalChecked();
 
         return obj;
@@ -61,13 +76,35 @@ public:
 
     v8::Local<v8::Value> CreateInstance(v8::Isolate* isolate, v8::Local<v8::Context> ctx, std::vector<v8::Local<v8::Value>> args);
 
+    v8::Local<v8::FunctionTemplate> GetTemplate(v8::Isolate* isolate)
+    {
+        if(isolate == mainIsolate) return mainTpl.Get(isolate);
+
+        return tplMap.at(isolate).Get(isolate);
+    }
+
+    // Brand check against the template, unlike InstanceOf it doesn't walk the prototype chain in JS.
+    // Isolates the class wasn't loaded in can't have instances
+    bool HasInstance(v8::Isolate* isolate, v8::Local<v8::Value> val)
+    {
+        v8::Local<v8::FunctionTemplate> _tpl = FindTemplate(isolate);
+        if(_tpl.IsEmpty()) return false;
+
+        return _tpl->HasInstance(val);
+    }
+
     v8::Local<v8::Function> JSValue(v8::Isolate* isolate, v8::Local<v8::Context> ctx)
     {
-        return tplMap.at(isolate).Get(isolate)->GetFunction(ctx).ToLocalChecked();
+        return GetTemplate(isolate)->GetFunction(ctx).ToLocalChecked();
     }
 
     v8::Local<v8::Value> New(v8::Local<v8::Context> ctx, std::vector<v8::Local<v8::Value>>& args);
 
+    void SetInheritedInit(InitCallback&& init)
+    {
+        inheritedInitCb = std::move(init);
+    }
+
     static void LoadAll(v8::Isolate* isolate)
     {
         for(auto& p : All()) p.second->Load(isolate);
@@ -85,21 +122,31 @@ public:
         if(parent)
         {
             parent->Load(isolate);
-            auto parenttpl = parent->tplMap.at(isolate).Get(isolate);
+            auto parenttpl = parent->GetTemplate(isolate);
             _tpl->Inherit(parenttpl);
 
             // if parent has more internal fields,
             // set the current internal field count to the parent's count
             auto parentInternalFieldCount = parenttpl->InstanceTemplate()->InternalFieldCount();
             if(parentInternalFieldCount > _tpl->InstanceTemplate()->InternalFieldCount()) _tpl->InstanceTemplate()->SetInternalFieldCount(parentInternalFieldCount);
+
+            for(V8Class* p = parent; p; p = p->parent)
+            {
+                if(p->inheritedInitCb) p->inheritedInitCb(_tpl);
+            }
         }
 
         tplMap.insert({ isolate, { isolate, _tpl } });
+        if(!mainIsolate)
+        {
+            mainIsolate = isolate;
+            mainTpl.Reset(isolate, _tpl);
+        }
     }
 
     void Register(v8::Isolate* isolate, v8::Local<v8::Context> context, v8::Local<v8::Object> exports)
     {
         exports->Set(
-          context, v8::String::NewFromUtf8(isolate, name.c_str(), v8::NewStringType::kNormal).ToLocalChecked(), tplMap.at(isolate).Get(isolate)->GetFunction(context).ToLocalChecked());
+          context, v8::String::NewFromUtf8(isolate, name.c_str(), v8::NewStringType::kNormal).ToLocalChecked(), GetTemplate(isolate)->GetFunction(context).ToLocalChecked());
     }
 };
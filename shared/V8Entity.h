@@ -5,18 +5,44 @@
 #include "cpp-sdk/objects/IEntity.h"
 
 #include "V8Class.h"
+#include "V8EntityTable.h"
+#include "V8ObjectPool.h"
+
+class V8ResourceImpl;
 
 class V8Entity
 {
     V8Class* _class;
     alt::Ref<alt::IBaseObject> handle;
     v8::Persistent<v8::Object, v8::CopyablePersistentTraits<v8::Object>> jsVal;
+    bool weak = false;
+    V8ResourceImpl* weakOwner = nullptr;
+    V8::EntityTable::SlotRef slot;
+    // Scripts added properties to the wrapper, so it must never be recreated
+    bool pinned = false;
+
+    // Interfaces the handle was already cast to, keyed by CastTag<T>()
+    struct CastEntry
+    {
+        const void* tag = nullptr;
+        void* ptr = nullptr;
+    };
+    static constexpr int CastCacheSize = 4;
+    CastEntry casts[CastCacheSize];
+    uint8_t nextCast = 0;
 
 public:
+    // No other template uses this field count (Vector2 and MemoryBuffer have 2, Vector3 3, RGBA 4),
+    // the tag tells wrappers apart from foreign objects like node's that happen to have as many fields
+    static constexpr int InternalFieldCount = 5;
+    static constexpr int EntityField = 0;
+    static constexpr int TagField = 1;
+
     V8Entity(v8::Local<v8::Context> ctx, V8Class* __class, v8::Local<v8::Object> obj, alt::Ref<alt::IBaseObject> _handle) : _class(__class), handle(_handle)
     {
         v8::Isolate* isolate = v8::Isolate::GetCurrent();
-        obj->SetInternalField(0, v8::External::New(isolate, this));
+        obj->SetAlignedPointerInInternalField(EntityField, this);
+        obj->SetAlignedPointerInInternalField(TagField, Tag());
         jsVal.Reset(isolate, obj);
     }
 
@@ -30,22 +56,134 @@ public:
         return handle;
     }
 
+    // Doesn't touch the ref count, the pointer must not be used after the entity could have been removed.
+    // Wrappers are used through a handful of interfaces (IBaseObject, IWorldObject, IEntity and the concrete one),
+    // each is cast once and then found by comparing tags
+    template<class T>
+    T* GetHandleBorrowed()
+    {
+        const void* tag = CastTag<T>();
+        for(CastEntry& entry : casts)
+        {
+            if(entry.tag == tag) return static_cast<T*>(entry.ptr);
+        }
+
+        T* ptr = dynamic_cast<T*>(handle.Get());
+        casts[nextCast] = { tag, ptr };
+        nextCast = (nextCast + 1) % CastCacheSize;
+        return ptr;
+    }
+
     v8::Local<v8::Object> GetJSVal(v8::Isolate* isolate)
     {
         return jsVal.Get(isolate);
     }
 
+    V8::EntityTable::SlotRef GetSlot() const
+    {
+        return slot;
+    }
+
+    void SetSlot(V8::EntityTable::SlotRef _slot)
+    {
+        slot = _slot;
+    }
+
+    // Wrappers are recycled through a free list, entities streaming in and out don't hit malloc
+    static void* operator new(size_t)
+    {
+        return Pool().Allocate();
+    }
+    static void operator delete(void* ptr)
+    {
+        Pool().Free(ptr);
+    }
+
+    bool IsWeak() const
+    {
+        return weak;
+    }
+
+    bool IsPinned() const
+    {
+        return pinned;
+    }
+
+    V8ResourceImpl* GetWeakOwner()
+    {
+        return weakOwner;
+    }
+
+    // The wrapper may be collected once JS doesn't reference it anymore, the callback has to forget and delete it
+    void SetWeak(V8ResourceImpl* owner, v8::WeakCallbackInfo<V8Entity>::Callback callback)
+    {
+        if(weak || pinned) return;
+
+        weakOwner = owner;
+        jsVal.SetWeak(this, callback, v8::WeakCallbackType::kParameter);
+        weak = true;
+    }
+
+    // Called from the weak callback, the handle can't be used anymore
+    void ResetJSVal()
+    {
+        jsVal.Reset();
+        weak = false;
+    }
+
+    void Pin()
+    {
+        pinned = true;
+        if(!weak) return;
+
+        jsVal.ClearWeak();
+        weak = false;
+    }
+
+    // Wrappers without script properties can be collected while they aren't referenced and are recreated on the next access,
+    // off by default as a recreated wrapper isn't found in WeakMaps/WeakSets keyed by the old one
+    static bool IsWeakEnabled()
+    {
+        return WeakEnabled();
+    }
+
+    // Has to be called before the classes are loaded, scripts adding properties pin the wrapper
+    // through interceptors that are only installed when weak wrappers are allowed
+    static void AllowWeak()
+    {
+        WeakAllowed() = true;
+        WeakEnabled() = true;
+    }
+
+    static bool IsWeakAllowed()
+    {
+        return WeakAllowed();
+    }
+
+    // Fails when enabling without weak wrappers being allowed at startup
+    static bool SetWeakEnabled(bool enabled)
+    {
+        if(enabled && !WeakAllowed()) return false;
+
+        WeakEnabled() = enabled;
+        return true;
+    }
+
     static V8Entity* Get(v8::Local<v8::Value> val)
     {
         if(!val->IsObject()) return nullptr;
 
         v8::Local<v8::Object> obj = val.As<v8::Object>();
-        if(obj->InternalFieldCount() != 1) return nullptr;
+        if(obj->InternalFieldCount() != InternalFieldCount) return nullptr;
+        if(obj->GetAlignedPointerFromInternalField(TagField) != Tag()) return nullptr;
 
-        v8::Local<v8::Value> i = obj->GetInternalField(0);
-        if(!i->IsExternal()) return nullptr;
+        return static_cast<V8Entity*>(obj->GetAlignedPointerFromInternalField(EntityField));
+    }
 
-        return static_cast<V8Entity*>(i.As<v8::External>()->Value());
+    // For receivers V8 already checked against an entity template through an AccessorSignature
+    static V8Entity* GetUnchecked(v8::Local<v8::Object> obj)
+    {
+        return static_cast<V8Entity*>(obj->GetAlignedPointerFromInternalField(EntityField));
     }
 
     static V8Class* GetClass(alt::Ref<alt::IBaseObject> handle)
@@ -76,4 +214,36 @@ public:
 
         return nullptr;
     }
+
+private:
+    static void* Tag()
+    {
+        alignas(8) static char _tag;
+        return &_tag;
+    }
+
+    template<class T>
+    static const void* CastTag()
+    {
+        static char _tag;
+        return &_tag;
+    }
+
+    static V8::ObjectPool<V8Entity>& Pool()
+    {
+        static V8::ObjectPool<V8Entity> _pool;
+        return _pool;
+    }
+
+    static bool& WeakEnabled()
+    {
+        static bool _enabled = false;
+        return _enabled;
+    }
+
+    static bool& WeakAllowed()
+    {
+        static bool _allowed = false;
+        return _allowed;
+    }
 };
@@ -0,0 +1,183 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "cpp-sdk/objects/IBaseObject.h"
+
+class V8Entity;
+
+namespace V8
+{
+    // Entity wrappers of a resource. They live in a dense slot array, whose slots are reused
+    // with a new generation, so stale slot references of collected wrappers can be detected.
+    // Handles are mapped to their slot through a flat open addressed index, a lookup is a
+    // multiplicative hash of the pointer and usually a single probe.
+    // Not keyed by GetID(): only IEntity has an ID, blips, colshapes, webviews etc. don't, and getting
+    // it from an IBaseObject* takes a dynamic_cast through the virtual bases, more than the hash costs
+    class EntityTable
+    {
+    public:
+        static constexpr uint32_t InvalidSlot = UINT32_MAX;
+
+        struct SlotRef
+        {
+            uint32_t index = InvalidSlot;
+            uint32_t generation = 0;
+        };
+
+        V8Entity* Get(alt::IBaseObject* handle) const
+        {
+            uint32_t pos = Find(handle);
+            return pos == InvalidSlot ? nullptr : slots[index[pos]].entity;
+        }
+
+        SlotRef Insert(alt::IBaseObject* handle, V8Entity* entity)
+        {
+            if((count + 1) * 2 > index.size()) Rehash(index.empty() ? 64 : index.size() * 2);
+
+            uint32_t slot;
+            if(freeSlots.empty())
+            {
+                slot = uint32_t(slots.size());
+                slots.push_back({});
+            }
+            else
+            {
+                slot = freeSlots.back();
+                freeSlots.pop_back();
+            }
+
+            slots[slot].handle = handle;
+            slots[slot].entity = entity;
+
+            uint32_t pos = Home(handle);
+            while(index[pos] != InvalidSlot) pos = (pos + 1) & mask;
+            index[pos] = slot;
+            ++count;
+
+            return { slot, slots[slot].generation };
+        }
+
+        // Returns the removed wrapper, which is not deleted
+        V8Entity* Remove(alt::IBaseObject* handle)
+        {
+            uint32_t pos = Find(handle);
+            if(pos == InvalidSlot) return nullptr;
+
+            return RemoveAt(pos);
+        }
+
+        // Only removes the slot if it wasn't reused since ref was handed out
+        V8Entity* Remove(SlotRef ref)
+        {
+            if(ref.index >= slots.size() || slots[ref.index].generation != ref.generation || !slots[ref.index].entity) return nullptr;
+
+            return RemoveAt(Find(slots[ref.index].handle));
+        }
+
+        size_t GetSize() const
+        {
+            return count;
+        }
+
+        template<class Fn>
+        void ForEach(Fn&& fn) const
+        {
+            for(auto& slot : slots)
+            {
+                if(slot.entity) fn(slot.handle, slot.entity);
+            }
+        }
+
+        void Clear()
+        {
+            slots.clear();
+            freeSlots.clear();
+            index.clear();
+            mask = 0;
+            shift = 64;
+            count = 0;
+        }
+
+    private:
+        struct Slot
+        {
+            alt::IBaseObject* handle = nullptr;
+            V8Entity* entity = nullptr;
+            uint32_t generation = 0;
+        };
+
+        std::vector<Slot> slots;
+        std::vector<uint32_t> freeSlots;
+        // Slot indices, InvalidSlot marks an empty position
+        std::vector<uint32_t> index;
+        uint32_t mask = 0;
+        uint32_t shift = 64;
+        size_t count = 0;
+
+        uint32_t Home(alt::IBaseObject* handle) const
+        {
+            return uint32_t((uint64_t(uintptr_t(handle)) * 0x9E3779B97F4A7C15ull) >> shift);
+        }
+
+        uint32_t Find(alt::IBaseObject* handle) const
+        {
+            if(count == 0) return InvalidSlot;
+
+            for(uint32_t pos = Home(handle);; pos = (pos + 1) & mask)
+            {
+                uint32_t slot = index[pos];
+                if(slot == InvalidSlot) return InvalidSlot;
+                if(slots[slot].handle == handle) return pos;
+            }
+        }
+
+        V8Entity* RemoveAt(uint32_t pos)
+        {
+            uint32_t slot = index[pos];
+            V8Entity* entity = slots[slot].entity;
+
+            slots[slot].handle = nullptr;
+            slots[slot].entity = nullptr;
+            slots[slot].generation += 1;
+            freeSlots.push_back(slot);
+            --count;
+
+            // Shift the following entries back instead of leaving tombstones,
+            // an entry moves if the hole lies between its home and its position
+            uint32_t hole = pos;
+            for(uint32_t next = (pos + 1) & mask; index[next] != InvalidSlot; next = (next + 1) & mask)
+            {
+                uint32_t home = Home(slots[index[next]].handle);
+                if(((next - home) & mask) >= ((next - hole) & mask))
+                {
+                    index[hole] = index[next];
+                    hole = next;
+                }
+            }
+            index[hole] = InvalidSlot;
+
+            return entity;
+        }
+
+        void Rehash(size_t capacity)
+        {
+            index.assign(capacity, InvalidSlot);
+            mask = uint32_t(capacity - 1);
+
+            shift = 64;
+            for(size_t c = capacity; c > 1; c >>= 1) --shift;
+
+            for(uint32_t slot = 0; slot < slots.size(); ++slot)
+            {
+                if(!slots[slot].entity) continue;
+
+                uint32_t pos = Home(slots[slot].handle);
+                while(index[pos] != InvalidSlot) pos = (pos + 1) & mask;
+                index[pos] = slot;
+            }
+        }
+    };
+}  // namespace V8
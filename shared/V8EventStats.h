@@ -0,0 +1,173 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+
+namespace V8
+{
+    // Log-linear latency histogram in microseconds, every power of two is split into
+    // 16 buckets so percentiles are accurate to about 6%
+    class LatencyHistogram
+    {
+    public:
+        void Record(int64_t ns)
+        {
+            uint64_t us = (ns > 0) ? (uint64_t)ns / 1000 : 0;
+
+            ++buckets[BucketIndex(us)];
+            ++count;
+            if(us > max) max = us;
+        }
+
+        uint64_t GetCount() const
+        {
+            return count;
+        }
+
+        uint64_t GetMax() const
+        {
+            return max;
+        }
+
+        // Upper bound of the bucket the percentile falls into
+        uint64_t GetPercentile(double percentile) const
+        {
+            if(count == 0) return 0;
+
+            uint64_t target = std::max<uint64_t>(1, (uint64_t)std::ceil(percentile / 100.0 * count));
+            uint64_t seen = 0;
+            for(size_t i = 0; i < BucketCount; ++i)
+            {
+                seen += buckets[i];
+                if(seen >= target) return std::min(BucketUpperBound(i), max);
+            }
+
+            return max;
+        }
+
+    private:
+        static constexpr size_t SubBuckets = 16;
+        static constexpr size_t BucketCount = SubBuckets * 40;
+
+        static size_t BucketIndex(uint64_t us)
+        {
+            if(us < SubBuckets) return (size_t)us;
+
+            size_t msb = 0;
+            while(us >> (msb + 1)) ++msb;
+
+            size_t shift = msb - 4;
+            return std::min((shift + 1) * SubBuckets + (size_t)((us >> shift) - SubBuckets), BucketCount - 1);
+        }
+
+        static uint64_t BucketUpperBound(size_t idx)
+        {
+            if(idx < SubBuckets) return idx;
+
+            size_t shift = idx / SubBuckets - 1;
+            uint64_t sub = idx % SubBuckets + SubBuckets;
+            return ((sub + 1) << shift) - 1;
+        }
+
+        std::array<uint64_t, BucketCount> buckets{};
+        uint64_t count = 0;
+        uint64_t max = 0;
+    };
+
+    // Latencies of the event handlers and timers of a resource.
+    // Collection is off by default, when disabled the only cost is checking IsEnabled
+    class EventStats
+    {
+    public:
+        struct TimerKey
+        {
+            // Interned, see SourceLocation
+            const std::string* fileName;
+            int line;
+
+            bool operator==(const TimerKey& other) const
+            {
+                return fileName == other.fileName && line == other.line;
+            }
+        };
+
+        struct TimerKeyHash
+        {
+            size_t operator()(const TimerKey& key) const
+            {
+                return std::hash<const std::string*>()(key.fileName) ^ ((size_t)key.line * 31);
+            }
+        };
+
+        static bool IsEnabled()
+        {
+            return Enabled().load(std::memory_order_relaxed);
+        }
+
+        static void SetEnabled(bool enabled)
+        {
+            Enabled() = enabled;
+        }
+
+        // Monotonic clock in nanoseconds
+        static int64_t Now()
+        {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+        }
+
+        void RecordEvent(uint32_t eventId, int64_t ns)
+        {
+            events[eventId].Record(ns);
+        }
+
+        void RecordGenericEvent(int64_t ns)
+        {
+            genericEvents.Record(ns);
+        }
+
+        void RecordTimer(const std::string& fileName, int line, int64_t ns)
+        {
+            timers[{ &fileName, line }].Record(ns);
+        }
+
+        void Reset()
+        {
+            events.clear();
+            timers.clear();
+            genericEvents = LatencyHistogram{};
+        }
+
+        const std::unordered_map<uint32_t, LatencyHistogram>& GetEvents() const
+        {
+            return events;
+        }
+
+        const std::unordered_map<TimerKey, LatencyHistogram, TimerKeyHash>& GetTimers() const
+        {
+            return timers;
+        }
+
+        const LatencyHistogram& GetGenericEvents() const
+        {
+            return genericEvents;
+        }
+
+    private:
+        static std::atomic<bool>& Enabled()
+        {
+            static std::atomic<bool> _enabled{ false };
+            return _enabled;
+        }
+
+        // Keyed by V8::EventIds
+        std::unordered_map<uint32_t, LatencyHistogram> events;
+        std::unordered_map<TimerKey, LatencyHistogram, TimerKeyHash> timers;
+        LatencyHistogram genericEvents;
+    };
+}  // namespace V8
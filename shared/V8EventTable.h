@@ -0,0 +1,227 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <deque>
+#include <limits>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "V8Helpers.h"
+
+namespace V8
+{
+    // Event names are interned into dense ids once when subscribing,
+    // so looking up the handlers of an event is a plain array index.
+    // Process-wide as event handlers keep ids in statics, it's never cleared and grows with the distinct event names.
+    // Not synchronized, only the thread running the resources may use it, debug builds assert against concurrent use
+    class EventIds
+    {
+    public:
+        static constexpr uint32_t Invalid = std::numeric_limits<uint32_t>::max();
+
+        // Returns the id of the event, registering it if it wasn't known yet
+        static uint32_t Get(std::string_view name)
+        {
+            AccessGuard guard;
+            auto& ids = Ids();
+            auto it = ids.find(name);
+            if(it != ids.end()) return it->second;
+
+            auto& names = Names();
+            names.push_back(std::make_unique<std::string>(name));
+
+            uint32_t id = static_cast<uint32_t>(names.size() - 1);
+            ids.insert({ *names.back(), id });
+            return id;
+        }
+
+        // Returns the id of the event or Invalid if nobody ever subscribed to it
+        static uint32_t Find(std::string_view name)
+        {
+            AccessGuard guard;
+            auto& ids = Ids();
+            auto it = ids.find(name);
+
+            return (it != ids.end()) ? it->second : Invalid;
+        }
+
+        static const std::string& GetName(uint32_t id)
+        {
+            AccessGuard guard;
+            return *Names()[id];
+        }
+
+    private:
+        struct AccessGuard
+        {
+#ifndef NDEBUG
+            AccessGuard()
+            {
+                assert(!InUse().exchange(true) && "V8::EventIds used from two threads at once");
+            }
+            ~AccessGuard()
+            {
+                InUse() = false;
+            }
+
+            static std::atomic<bool>& InUse()
+            {
+                static std::atomic<bool> _inUse{ false };
+                return _inUse;
+            }
+#else
+            AccessGuard() {}
+#endif
+        };
+
+        // Keys are views into the interned names, which never move
+        static std::unordered_map<std::string_view, uint32_t>& Ids()
+        {
+            static std::unordered_map<std::string_view, uint32_t> _ids;
+            return _ids;
+        }
+
+        static std::vector<std::unique_ptr<std::string>>& Names()
+        {
+            static std::vector<std::unique_ptr<std::string>> _names;
+            return _names;
+        }
+    };
+
+    class EventHandlerTable
+    {
+    public:
+        using Callbacks = std::vector<EventCallback*>;
+
+        // An event is compacted once this many of its callbacks were removed,
+        // or earlier if they make up half of its callbacks
+        static constexpr uint32_t CompactThreshold = 32;
+
+        EventHandlerTable() = default;
+        EventHandlerTable(const EventHandlerTable&) = delete;
+
+        ~EventHandlerTable()
+        {
+            for(auto& entry : entries)
+            {
+                for(auto callback : entry.callbacks) delete callback;
+            }
+        }
+
+        void Subscribe(uint32_t id, EventCallback* callback)
+        {
+            if(id >= entries.size()) entries.resize(id + 1);
+
+            callback->table = this;
+            callback->eventId = id;
+            entries[id].callbacks.push_back(callback);
+        }
+
+        void Unsubscribe(uint32_t id, v8::Isolate* isolate, v8::Local<v8::Function> fn)
+        {
+            if(id >= entries.size()) return;
+
+            for(auto callback : entries[id].callbacks)
+            {
+                if(!callback->removed && callback->fn.Get(isolate)->StrictEquals(fn)) callback->Remove();
+            }
+        }
+
+        const Callbacks& Get(uint32_t id) const
+        {
+            if(id >= entries.size()) return Empty();
+
+            return entries[id].callbacks;
+        }
+
+        // Called by EventCallback::Remove
+        void OnRemoved(uint32_t id)
+        {
+            Entry& entry = entries[id];
+            ++entry.tombstones;
+
+            if(!entry.dirty && (entry.tombstones >= CompactThreshold || entry.tombstones * 2 >= entry.callbacks.size()))
+            {
+                entry.dirty = true;
+                dirty.push_back(id);
+            }
+        }
+
+        bool IsDirty() const
+        {
+            return !dirty.empty();
+        }
+
+        // Frees removed callbacks of the events that crossed the threshold,
+        // must not be called while the handlers are being invoked
+        void Compact()
+        {
+            for(auto id : dirty)
+            {
+                Entry& entry = entries[id];
+                Compact(entry.callbacks);
+
+                entry.tombstones = 0;
+                entry.dirty = false;
+            }
+
+            dirty.clear();
+        }
+
+        static void Compact(Callbacks& callbacks)
+        {
+            auto it = std::remove_if(callbacks.begin(), callbacks.end(), [](EventCallback* callback) {
+                if(!callback->removed) return false;
+
+                delete callback;
+                return true;
+            });
+
+            callbacks.erase(it, callbacks.end());
+        }
+
+        // Removed callbacks stay in the array until the next compaction
+        static bool HasLive(const Callbacks& callbacks)
+        {
+            for(auto callback : callbacks)
+            {
+                if(!callback->removed) return true;
+            }
+
+            return false;
+        }
+
+        static const Callbacks& Empty()
+        {
+            static Callbacks _empty;
+            return _empty;
+        }
+
+    private:
+        struct Entry
+        {
+            Callbacks callbacks;
+            // Removed callbacks that are still in the array
+            uint32_t tombstones = 0;
+            bool dirty = false;
+        };
+
+        // Deque so references to the callbacks of an event stay valid
+        // when a handler subscribes to an event that wasn't registered yet
+        std::deque<Entry> entries;
+        std::vector<uint32_t> dirty;
+    };
+
+    inline void EventCallback::Remove()
+    {
+        if(removed) return;
+
+        removed = true;
+        if(table) table->OnRemoved(eventId);
+    }
+}  // namespace V8
@@ -2,7 +2,12 @@
 #include "cpp-sdk/ICore.h"
 #include "V8ResourceImpl.h"
 #include "V8Helpers.h"
+#include <atomic>
 #include <climits>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <unordered_map>
 
 bool V8Helpers::TryCatch(const std::function<bool()>& fn)
 {
@@ -85,6 +90,21 @@ void V8Helpers::RegisterFunc(v8::Local<v8::Object> exports, const std::string& _
     exports->Set(ctx, name, fn);
 }
 
+void V8Helpers::RegisterFastFunc(v8::Local<v8::Object> exports, const std::string& _name, v8::FunctionCallback cb, const v8::CFunction* fastCb)
+{
+    v8::Isolate* isolate = v8::Isolate::GetCurrent();
+    v8::Local<v8::Context> ctx = isolate->GetEnteredOrMicrotaskContext();
+
+    v8::Local<v8::String> name = V8::JSValue(_name);
+
+    v8::Local<v8::FunctionTemplate> tpl = v8::FunctionTemplate::New(
+      isolate, cb, v8::Local<v8::Value>(), v8::Local<v8::Signature>(), 0, v8::ConstructorBehavior::kThrow, v8::SideEffectType::kHasSideEffect, fastCb);
+    v8::Local<v8::Function> fn = tpl->GetFunction(ctx).ToLocalChecked();
+    fn->SetName(name);
+
+    exports->Set(ctx, name, fn);
+}
+
 void V8Helpers::RegisterProperty(v8::Local<v8::Object> exports, const std::string& _name, v8::AccessorNameGetterCallback getter, v8::AccessorNameSetterCallback setter, void* data)
 {
     v8::Isolate* isolate = v8::Isolate::GetCurrent();
@@ -196,34 +216,21 @@ alt::MValue V8Helpers::V8ToMValue(v8::Local<v8::Value> val, bool allowFunction)
             V8ResourceImpl* resource = V8ResourceImpl::Get(ctx);
             v8::Local<v8::Object> v8Obj = val.As<v8::Object>();
 
-            // if (v8Obj->InstanceOf(ctx, v8Vector3->JSValue(isolate, ctx)).ToChecked())
+            // Brand checks against the class templates, they don't call into JS
             if(resource->IsVector3(v8Obj))
             {
-                v8::Local<v8::Value> x, y, z;
-                V8_CHECK_RETN(v8Obj->Get(ctx, V8::Vector3_XKey(isolate)).ToLocal(&x), "Failed to convert Vector3 to MValue", core.CreateMValueNil());
-                V8_CHECK_RETN(v8Obj->Get(ctx, V8::Vector3_YKey(isolate)).ToLocal(&y), "Failed to convert Vector3 to MValue", core.CreateMValueNil());
-                V8_CHECK_RETN(v8Obj->Get(ctx, V8::Vector3_ZKey(isolate)).ToLocal(&z), "Failed to convert Vector3 to MValue", core.CreateMValueNil());
-
-                return core.CreateMValueVector3(alt::Vector3f{ x.As<v8::Number>()->Value(), y.As<v8::Number>()->Value(), z.As<v8::Number>()->Value() });
+                return core.CreateMValueVector3(alt::Vector3f{ V8::GetNumberField(v8Obj, 0), V8::GetNumberField(v8Obj, 1), V8::GetNumberField(v8Obj, 2) });
             }
             else if(resource->IsVector2(v8Obj))
             {
-                v8::Local<v8::Value> x, y;
-                V8_CHECK_RETN(v8Obj->Get(ctx, V8::Vector3_XKey(isolate)).ToLocal(&x), "Failed to convert Vector2 to MValue", core.CreateMValueNil());
-                V8_CHECK_RETN(v8Obj->Get(ctx, V8::Vector3_YKey(isolate)).ToLocal(&y), "Failed to convert Vector2 to MValue", core.CreateMValueNil());
-
-                return core.CreateMValueVector2(alt::Vector2f{ x.As<v8::Number>()->Value(), y.As<v8::Number>()->Value() });
+                return core.CreateMValueVector2(alt::Vector2f{ V8::GetNumberField(v8Obj, 0), V8::GetNumberField(v8Obj, 1) });
             }
             else if(resource->IsRGBA(v8Obj))
             {
-                v8::Local<v8::Value> r, g, b, a;
-                V8_CHECK_RETN(v8Obj->Get(ctx, V8::RGBA_RKey(isolate)).ToLocal(&r), "Failed to convert RGBA to MValue", core.CreateMValueNil());
-                V8_CHECK_RETN(v8Obj->Get(ctx, V8::RGBA_GKey(isolate)).ToLocal(&g), "Failed to convert RGBA to MValue", core.CreateMValueNil());
-                V8_CHECK_RETN(v8Obj->Get(ctx, V8::RGBA_BKey(isolate)).ToLocal(&b), "Failed to convert RGBA to MValue", core.CreateMValueNil());
-                V8_CHECK_RETN(v8Obj->Get(ctx, V8::RGBA_AKey(isolate)).ToLocal(&a), "Failed to convert RGBA to MValue", core.CreateMValueNil());
-
-                return core.CreateMValueRGBA(
-                  alt::RGBA{ (uint8_t)r.As<v8::Number>()->Value(), (uint8_t)g.As<v8::Number>()->Value(), (uint8_t)b.As<v8::Number>()->Value(), (uint8_t)a.As<v8::Number>()->Value() });
+                return core.CreateMValueRGBA(alt::RGBA{ (uint8_t)V8::GetNumberField(v8Obj, 0),
+                                                        (uint8_t)V8::GetNumberField(v8Obj, 1),
+                                                        (uint8_t)V8::GetNumberField(v8Obj, 2),
+                                                        (uint8_t)V8::GetNumberField(v8Obj, 3) });
             }
             else if(resource->IsBaseObject(v8Obj))
             {
@@ -338,9 +345,165 @@ v8::Local<v8::Value> V8Helpers::MValueToV8(alt::MValueConst val)
     return v8::Undefined(isolate);
 }
 
-void V8Helpers::MValueArgsToV8(alt::MValueArgs args, std::vector<v8::Local<v8::Value>>& v8Args)
+bool V8::MValueArgsCache::Matches(v8::Isolate* _isolate, const alt::MValueArgs& _args)
+{
+    if(isolate != _isolate || args.GetSize() != _args.GetSize()) return false;
+
+    for(uint64_t i = 0; i < args.GetSize(); ++i)
+    {
+        if(args[i].Get() != _args[i].Get()) return false;
+    }
+
+    return true;
+}
+
+void V8::MValueArgsCache::Convert(const alt::MValueArgs& _args, EventArgs& v8Args)
+{
+    v8::Isolate* _isolate = v8::Isolate::GetCurrent();
+
+    if(!Matches(_isolate, _args))
+    {
+        // Only worth building the cache once the same arguments are seen by a second resource
+        Clear();
+        isolate = _isolate;
+        args = _args;
+
+        V8Helpers::MValueArgsToV8(_args, v8Args);
+        return;
+    }
+
+    Materialize(_args, v8Args);
+}
+
+void V8::MValueArgsCache::Materialize(const alt::MValueArgs& _args, EventArgs& v8Args)
+{
+    v8::Isolate* _isolate = v8::Isolate::GetCurrent();
+
+    if(!Matches(_isolate, _args))
+    {
+        Clear();
+        isolate = _isolate;
+        args = _args;
+    }
+
+    if(!built)
+    {
+        for(uint64_t i = 0; i < args.GetSize(); ++i) Build(args[i]);
+        built = true;
+    }
+
+    v8::Local<v8::Value> objectProto = v8::Object::New(isolate)->GetPrototype();
+
+    size_t idx = 0;
+    for(uint64_t i = 0; i < args.GetSize(); ++i) v8Args.push_back(Materialize(objectProto, idx));
+}
+
+void V8::MValueArgsCache::Clear()
+{
+    isolate = nullptr;
+    args = alt::MValueArgs();
+    built = false;
+
+    nodes.clear();
+    keys.clear();
+}
+
+void V8::MValueArgsCache::Build(alt::MValueConst val)
+{
+    size_t node = nodes.size();
+    nodes.emplace_back();
+
+    switch(val->GetType())
+    {
+        case alt::IMValue::Type::NONE:
+        case alt::IMValue::Type::NIL:
+        case alt::IMValue::Type::BOOL:
+        case alt::IMValue::Type::INT:
+        case alt::IMValue::Type::UINT:
+        case alt::IMValue::Type::DOUBLE:
+        case alt::IMValue::Type::STRING:
+        {
+            nodes[node].type = Node::Type::PRIMITIVE;
+            nodes[node].value.Reset(isolate, V8Helpers::MValueToV8(val));
+            break;
+        }
+        case alt::IMValue::Type::LIST:
+        {
+            alt::MValueListConst list = val.As<alt::IMValueList>();
+            nodes[node].type = Node::Type::LIST;
+            nodes[node].size = (uint32_t)list->GetSize();
+
+            for(uint32_t i = 0; i < list->GetSize(); ++i) Build(list->Get(i));
+            break;
+        }
+        case alt::IMValue::Type::DICT:
+        {
+            alt::MValueDictConst dict = val.As<alt::IMValueDict>();
+            nodes[node].type = Node::Type::DICT;
+            nodes[node].keysOffset = (uint32_t)keys.size();
+
+            // Keys of a dict have to be contiguous, so they are added before building nested dicts
+            std::vector<alt::MValueConst> dictValues;
+            for(auto it = dict->Begin(); it; it = dict->Next())
+            {
+                const alt::String& key = it->GetKey();
+                keys.emplace_back(isolate, v8::String::NewFromUtf8(isolate, key.GetData(), v8::NewStringType::kInternalized, (int)key.GetSize()).ToLocalChecked());
+                dictValues.push_back(it->GetValue());
+            }
+
+            nodes[node].size = (uint32_t)dictValues.size();
+            for(auto& dictValue : dictValues) Build(dictValue);
+            break;
+        }
+        default:
+        {
+            nodes[node].type = Node::Type::MVALUE;
+            nodes[node].mvalue = val;
+            break;
+        }
+    }
+}
+
+v8::Local<v8::Value> V8::MValueArgsCache::Materialize(v8::Local<v8::Value> objectProto, size_t& idx)
 {
-    for(uint64_t i = 0; i < args.GetSize(); ++i) v8Args.push_back(MValueToV8(args[i]));
+    Node& node = nodes[idx++];
+
+    switch(node.type)
+    {
+        case Node::Type::PRIMITIVE: return node.value.Get(isolate);
+        case Node::Type::MVALUE: return V8Helpers::MValueToV8(node.mvalue);
+        case Node::Type::LIST:
+        {
+            size_t base = values.size();
+            for(uint32_t i = 0; i < node.size; ++i)
+            {
+                v8::Local<v8::Value> value = Materialize(objectProto, idx);
+                values.push_back(value);
+            }
+
+            v8::Local<v8::Array> arr = v8::Array::New(isolate, values.data() + base, node.size);
+            values.resize(base);
+            return arr;
+        }
+        case Node::Type::DICT:
+        {
+            size_t base = values.size();
+            size_t namesBase = names.size();
+            for(uint32_t i = 0; i < node.size; ++i)
+            {
+                v8::Local<v8::Value> value = Materialize(objectProto, idx);
+                values.push_back(value);
+                names.push_back(keys[node.keysOffset + i].Get(isolate));
+            }
+
+            v8::Local<v8::Object> obj = v8::Object::New(isolate, objectProto, names.data() + namesBase, values.data() + base, node.size);
+            values.resize(base);
+            names.resize(namesBase);
+            return obj;
+        }
+    }
+
+    return v8::Undefined(isolate);
 }
 
 void V8Helpers::SetAccessor(v8::Local<v8::Template> tpl, v8::Isolate* isolate, const char* name, v8::AccessorGetterCallback getter, v8::AccessorSetterCallback setter)
@@ -348,6 +511,52 @@ void V8Helpers::SetAccessor(v8::Local<v8::Template> tpl, v8::Isolate* isolate, c
     tpl->SetNativeDataProperty(v8::String::NewFromUtf8(isolate, name, v8::NewStringType::kInternalized).ToLocalChecked(), getter, setter);
 }
 
+bool V8Helpers::HandleSharedCommand(alt::Array<alt::StringView>& args)
+{
+    if(args.GetSize() == 0) return false;
+
+    std::string_view arg = (args.GetSize() > 1) ? std::string_view{ args[1].GetData(), args[1].GetSize() } : std::string_view{};
+
+    if(args[0] == "--weak-entities")
+    {
+        if(arg != "on" && arg != "off")
+        {
+            Log::Colored << "~y~Usage: ~w~js-module --weak-entities [on|off]" << Log::Endl;
+        }
+        else if(!V8Entity::SetWeakEnabled(arg == "on"))
+        {
+            Log::Colored << "~r~Weak entity wrappers weren't allowed at startup" << Log::Endl;
+        }
+        else
+        {
+            Log::Colored << "~ly~Weak entity wrappers are now " << (arg == "on" ? "enabled" : "disabled") << " for new wrappers" << Log::Endl;
+        }
+    }
+    else if(args[0] == "--source-locations")
+    {
+        V8::SourceLocation::CaptureMode mode;
+        if(V8::SourceLocation::ParseCaptureMode(arg, mode))
+        {
+            V8::SourceLocation::SetCaptureMode(mode);
+            Log::Colored << "~ly~Source locations are now captured in " << std::string{ arg } << " mode" << Log::Endl;
+        }
+        else
+        {
+            Log::Colored << "~y~Usage: ~w~js-module --source-locations [off|lazy|full]" << Log::Endl;
+        }
+    }
+    else
+        return false;
+
+    return true;
+}
+
+void V8Helpers::PrintSharedCommandHelp()
+{
+    Log::Colored << "  ~ly~--source-locations [off|lazy|full] ~w~- how source locations of handlers and timers are captured." << Log::Endl;
+    Log::Colored << "  ~ly~--weak-entities [on|off] ~w~- whether unreferenced entity wrappers can be collected and recreated, has to be allowed at startup." << Log::Endl;
+}
+
 void V8::DefineOwnProperty(v8::Isolate* isolate, v8::Local<v8::Context> ctx, v8::Local<v8::Object> val, const char* name, v8::Local<v8::Value> value, v8::PropertyAttribute attributes)
 {
     val->DefineOwnProperty(ctx, v8::String::NewFromUtf8(isolate, name, v8::NewStringType::kInternalized).ToLocalChecked(), value, attributes);
@@ -369,11 +578,30 @@ void V8::SetAccessor(v8::Isolate* isolate, v8::Local<v8::FunctionTemplate> tpl,
                                           setter != nullptr ? v8::PropertyAttribute::None : v8::PropertyAttribute::ReadOnly);
 }
 
+void V8::SetInstanceAccessor(v8::Isolate* isolate, v8::Local<v8::FunctionTemplate> tpl, const char* name, v8::AccessorGetterCallback getter)
+{
+    tpl->InstanceTemplate()->SetAccessor(v8::String::NewFromUtf8(isolate, name, v8::NewStringType::kInternalized).ToLocalChecked(),
+                                         getter,
+                                         nullptr,
+                                         v8::Local<v8::Value>(),
+                                         v8::AccessControl::DEFAULT,
+                                         v8::PropertyAttribute::ReadOnly);
+}
+
 void V8::SetMethod(v8::Isolate* isolate, v8::Local<v8::FunctionTemplate> tpl, const char* name, v8::FunctionCallback callback)
 {
     tpl->PrototypeTemplate()->Set(isolate, name, v8::FunctionTemplate::New(isolate, callback));
 }
 
+void V8::SetFastMethod(v8::Isolate* isolate, v8::Local<v8::FunctionTemplate> tpl, const char* name, v8::FunctionCallback callback, const v8::CFunction* fastCallback)
+{
+    tpl->PrototypeTemplate()->Set(
+      isolate,
+      name,
+      v8::FunctionTemplate::New(
+        isolate, callback, v8::Local<v8::Value>(), v8::Local<v8::Signature>(), 0, v8::ConstructorBehavior::kAllow, v8::SideEffectType::kHasSideEffect, fastCallback));
+}
+
 void V8::SetStaticAccessor(v8::Isolate* isolate, v8::Local<v8::FunctionTemplate> tpl, const char* name, v8::AccessorGetterCallback getter, v8::AccessorSetterCallback setter)
 {
     tpl->SetNativeDataProperty(v8::String::NewFromUtf8(isolate, name, v8::NewStringType::kInternalized).ToLocalChecked(), getter, setter);
@@ -420,48 +648,131 @@ v8::Local<v8::Value> V8::New(v8::Isolate* isolate, v8::Local<v8::Context> ctx, v
     return obj;
 }
 
+// File names are interned, so capturing a location doesn't allocate once its file is known
+static const std::string& InternFileName(std::string_view name)
+{
+    static std::mutex mutex;
+    static std::unordered_map<std::string_view, std::unique_ptr<std::string>> fileNames;
+
+    // Workers capture locations on their own threads
+    std::lock_guard<std::mutex> lock(mutex);
+
+    auto it = fileNames.find(name);
+    if(it != fileNames.end()) return *it->second;
+
+    auto fileName = std::make_unique<std::string>(name);
+    const std::string& result = *fileName;
+    fileNames.emplace(result, std::move(fileName));
+    return result;
+}
+
+static const std::string& InternFileName(v8::Isolate* isolate, v8::Local<v8::String> name)
+{
+    char buffer[256];
+    int length = name->Utf8Length(isolate);
+
+    if(length > (int)sizeof(buffer)) return InternFileName(*v8::String::Utf8Value(isolate, name));
+
+    name->WriteUtf8(isolate, buffer, length, nullptr, v8::String::NO_NULL_TERMINATION);
+    return InternFileName(std::string_view{ buffer, (size_t)length });
+}
+
+static std::atomic<V8::SourceLocation::CaptureMode> captureMode{ V8::SourceLocation::CaptureMode::LAZY };
+
+// Workers have no resource, each of them runs its isolate on its own thread
+static thread_local V8::ScriptNames workerScriptNames;
+
 V8::SourceLocation V8::SourceLocation::GetCurrent(v8::Isolate* isolate)
 {
-    v8::Local<v8::StackTrace> stackTrace = v8::StackTrace::CurrentStackTrace(isolate, 1);
-    auto ctx = isolate->GetEnteredOrMicrotaskContext();
+    alt::IResource* resource = nullptr;
+    V8::ScriptNames* scripts = &workerScriptNames;
+    // Check if not inside a worker
+    if(!(*static_cast<bool*>(isolate->GetData(v8::Isolate::GetNumberOfDataSlots() - 1))))
+    {
+        V8ResourceImpl* impl = V8ResourceImpl::Get(isolate->GetEnteredOrMicrotaskContext());
+        if(impl)
+        {
+            resource = impl->GetResource();
+            scripts = &impl->GetScriptNames();
+        }
+    }
+
+    CaptureMode mode = GetCaptureMode();
+    if(mode == CaptureMode::OFF) return SourceLocation{ scripts, UnknownScript, 0, resource };
+
+    v8::StackTrace::StackTraceOptions options = (mode == CaptureMode::LAZY) ? v8::StackTrace::StackTraceOptions(v8::StackTrace::kLineNumber | v8::StackTrace::kScriptId | v8::StackTrace::kIsEval) :
+                                                                              v8::StackTrace::kDetailed;
+    v8::Local<v8::StackTrace> stackTrace = v8::StackTrace::CurrentStackTrace(isolate, 1, options);
+
     if(stackTrace->GetFrameCount() > 0)
     {
         v8::Local<v8::StackFrame> frame = stackTrace->GetFrame(isolate, 0);
+        int scriptId = frame->GetScriptId();
 
-        v8::Local<v8::Value> name = frame->GetScriptName();
-        if(!name.IsEmpty())
-        {
-            std::string fileName = *v8::String::Utf8Value(isolate, frame->GetScriptName());
-            int line = frame->GetLineNumber();
-
-            return SourceLocation{ std::move(fileName), line, ctx };
-        }
-        else if(frame->IsEval())
+        // Unnamed scripts are not stored, eval creates a new script every time
+        if(mode == CaptureMode::FULL || !scripts->Get(scriptId))
         {
-            return SourceLocation{ "[eval]", 0, ctx };
+            v8::Local<v8::String> name = frame->GetScriptName();
+            if(!name.IsEmpty()) scripts->Set(scriptId, &InternFileName(isolate, name));
         }
+
+        if(scripts->Get(scriptId)) return SourceLocation{ scripts, scriptId, frame->GetLineNumber(), resource };
+        if(frame->IsEval()) return SourceLocation{ scripts, EvalScript, 0, resource };
     }
 
-    return SourceLocation{ "[unknown]", 0, ctx };
+    return SourceLocation{ scripts, UnknownScript, 0, resource };
 }
 
-V8::SourceLocation::SourceLocation(std::string&& _fileName, int _line, v8::Local<v8::Context> ctx) : fileName(_fileName), line(_line)
+void V8::SourceLocation::SetCaptureMode(CaptureMode mode)
 {
-    context.Reset(ctx->GetIsolate(), ctx);
+    captureMode = mode;
 }
 
-std::string V8::SourceLocation::ToString()
+V8::SourceLocation::CaptureMode V8::SourceLocation::GetCaptureMode()
+{
+    return captureMode;
+}
+
+bool V8::SourceLocation::ParseCaptureMode(std::string_view name, CaptureMode& mode)
+{
+    if(name == "off") mode = CaptureMode::OFF;
+    else if(name == "lazy")
+        mode = CaptureMode::LAZY;
+    else if(name == "full")
+        mode = CaptureMode::FULL;
+    else
+        return false;
+
+    return true;
+}
+
+void V8::SourceLocation::DisposeIsolate(v8::Isolate*)
+{
+    workerScriptNames.Clear();
+}
+
+V8::SourceLocation::SourceLocation(const ScriptNames* _scripts, int _scriptId, int _line, alt::IResource* _resource)
+    : resource(_resource), scripts(_scripts), scriptId(_scriptId), line(_line)
+{
+}
+
+const std::string& V8::SourceLocation::GetFileName() const
 {
-    auto isolate = v8::Isolate::GetCurrent();
+    static const std::string& unknown = InternFileName("[unknown]");
+    static const std::string& eval = InternFileName("[eval]");
+
+    if(scriptId == EvalScript) return eval;
+
+    const std::string* fileName = scripts ? scripts->Get(scriptId) : nullptr;
+    return fileName ? *fileName : unknown;
+}
 
+std::string V8::SourceLocation::ToString()
+{
     std::stringstream stream;
     stream << "[";
-    // Check if not inside a worker
-    if(!(*static_cast<bool*>(isolate->GetData(v8::Isolate::GetNumberOfDataSlots() - 1))))
-    {
-        stream << V8ResourceImpl::Get(context.Get(v8::Isolate::GetCurrent()))->GetResource()->GetName().CStr() << ":";
-    }
-    stream << fileName << ":" << line << "]";
+    if(resource) stream << resource->GetName().CStr() << ":";
+    stream << GetFileName() << ":" << line << "]";
     return stream.str();
 }
 
@@ -620,6 +931,13 @@ bool V8::SafeToRGBA(v8::Local<v8::Value> val, v8::Local<v8::Context> ctx, alt::R
     {
         v8::Local val = maybeVal.ToLocalChecked();
 
+        V8ResourceImpl* resource = V8ResourceImpl::Get(ctx);
+        if(resource && resource->IsRGBA(val))
+        {
+            out = alt::RGBA{ uint8_t(GetNumberField(val, 0)), uint8_t(GetNumberField(val, 1)), uint8_t(GetNumberField(val, 2)), uint8_t(GetNumberField(val, 3)) };
+            return true;
+        }
+
         uint32_t r, g, b, a;
         if(SafeToUInt32(V8::Get(ctx, val, "r"), ctx, r) && SafeToUInt32(V8::Get(ctx, val, "g"), ctx, g) && SafeToUInt32(V8::Get(ctx, val, "b"), ctx, b) &&
            SafeToUInt32(V8::Get(ctx, val, "a"), ctx, a))
@@ -640,7 +958,7 @@ bool V8::SafeToVector3(v8::Local<v8::Value> val, v8::Local<v8::Context> ctx, alt
         v8::Local val = maybeVal.ToLocalChecked();
 
         double x, y, z;
-        if(SafeToNumber(V8::Get(ctx, val, "x"), ctx, x) && SafeToNumber(V8::Get(ctx, val, "y"), ctx, y) && SafeToNumber(V8::Get(ctx, val, "z"), ctx, z))
+        if(SafeToXYZ(val, ctx, x, y, z))
         {
             out = alt::Vector3f{ float(x), float(y), float(z) };
             return true;
@@ -658,7 +976,7 @@ bool V8::SafeToVector2(v8::Local<v8::Value> val, v8::Local<v8::Context> ctx, alt
         v8::Local val = maybeVal.ToLocalChecked();
 
         double x, y;
-        if(SafeToNumber(V8::Get(ctx, val, "x"), ctx, x) && SafeToNumber(V8::Get(ctx, val, "y"), ctx, y))
+        if(SafeToXY(val, ctx, x, y))
         {
             out = alt::Vector2f{ float(x), float(y) };
             return true;
@@ -668,6 +986,36 @@ bool V8::SafeToVector2(v8::Local<v8::Value> val, v8::Local<v8::Context> ctx, alt
     return false;
 }
 
+bool V8::SafeToXYZ(v8::Local<v8::Object> obj, v8::Local<v8::Context> ctx, double& x, double& y, double& z)
+{
+    V8ResourceImpl* resource = V8ResourceImpl::Get(ctx);
+    if(resource && resource->IsVector3(obj))
+    {
+        x = GetNumberField(obj, 0);
+        y = GetNumberField(obj, 1);
+        z = GetNumberField(obj, 2);
+        return true;
+    }
+
+    v8::Isolate* isolate = ctx->GetIsolate();
+    return SafeToNumber(V8::Get(ctx, obj, Vector3_XKey(isolate)), ctx, x) && SafeToNumber(V8::Get(ctx, obj, Vector3_YKey(isolate)), ctx, y) &&
+           SafeToNumber(V8::Get(ctx, obj, Vector3_ZKey(isolate)), ctx, z);
+}
+
+bool V8::SafeToXY(v8::Local<v8::Object> obj, v8::Local<v8::Context> ctx, double& x, double& y)
+{
+    V8ResourceImpl* resource = V8ResourceImpl::Get(ctx);
+    if(resource && resource->IsVector2(obj))
+    {
+        x = GetNumberField(obj, 0);
+        y = GetNumberField(obj, 1);
+        return true;
+    }
+
+    v8::Isolate* isolate = ctx->GetIsolate();
+    return SafeToNumber(V8::Get(ctx, obj, Vector3_XKey(isolate)), ctx, x) && SafeToNumber(V8::Get(ctx, obj, Vector3_YKey(isolate)), ctx, y);
+}
+
 bool V8::SafeToArrayBuffer(v8::Local<v8::Value> val, v8::Local<v8::Context> ctx, v8::Local<v8::ArrayBuffer>& out)
 {
     if(val->IsArrayBuffer())
@@ -701,16 +1049,14 @@ bool V8::SafeToArray(v8::Local<v8::Value> val, v8::Local<v8::Context> ctx, v8::L
     return false;
 }
 
-std::vector<V8::EventCallback*> V8::EventHandler::GetCallbacks(V8ResourceImpl* impl, const alt::CEvent* e)
+const std::vector<V8::EventCallback*>& V8::EventHandler::GetCallbacks(V8ResourceImpl* impl, const alt::CEvent* e)
 {
     return callbacksGetter(impl, e);
 }
 
-std::vector<v8::Local<v8::Value>> V8::EventHandler::GetArgs(V8ResourceImpl* impl, const alt::CEvent* e)
+void V8::EventHandler::GetArgs(V8ResourceImpl* impl, const alt::CEvent* e, EventArgs& args)
 {
-    std::vector<v8::Local<v8::Value>> args;
     argsGetter(impl, e, args);
-    return args;
 }
 
 V8::EventHandler* V8::EventHandler::Get(const alt::CEvent* e)
@@ -736,7 +1082,8 @@ void V8::EventHandler::Register(alt::CEvent::Type type, EventHandler* handler)
 
 V8::EventHandler::CallbacksGetter V8::LocalEventHandler::GetCallbacksGetter(const std::string& name)
 {
-    return [name](V8ResourceImpl* resource, const alt::CEvent*) -> std::vector<EventCallback*> { return resource->GetLocalHandlers(name); };
+    uint32_t id = EventIds::Get(name);
+    return [id](V8ResourceImpl* resource, const alt::CEvent*) -> const std::vector<EventCallback*>& { return resource->GetLocalHandlers(id); };
 }
 
 V8::EventHandler::EventHandler(alt::CEvent::Type type, CallbacksGetter&& _handlersGetter, ArgsGetter&& _argsGetter)
@@ -2,10 +2,17 @@
 
 #include <vector>
 #include <functional>
+#include <string_view>
 
 #include <v8.h>
 #include <limits>
 
+// Fast API calls returning values need V8 9, Node of the server still ships V8 8 and only gets the slow callbacks
+#if V8_MAJOR_VERSION >= 9
+    #include <v8-fast-api-calls.h>
+    #define V8_FAST_API_CALLS
+#endif
+
 #include "cpp-sdk/objects/IEntity.h"
 #include "cpp-sdk/types/MValue.h"
 #include "V8Entity.h"
@@ -58,6 +65,8 @@ namespace V8Helpers
     };
 
     void RegisterFunc(v8::Local<v8::Object> exports, const std::string& _name, v8::FunctionCallback cb, void* data = nullptr);
+    // fastCb is called from optimized code instead of cb if the arguments match its signature, see V8_FAST_CALLBACK
+    void RegisterFastFunc(v8::Local<v8::Object> exports, const std::string& _name, v8::FunctionCallback cb, const v8::CFunction* fastCb);
     void
       RegisterProperty(v8::Local<v8::Object> exports, const std::string& _name, v8::AccessorNameGetterCallback getter, v8::AccessorNameSetterCallback setter = nullptr, void* data = nullptr);
 
@@ -67,28 +76,83 @@ namespace V8Helpers
 
     v8::Local<v8::Value> MValueToV8(alt::MValueConst val);
 
-    void MValueArgsToV8(alt::MValueArgs args, std::vector<v8::Local<v8::Value>>& v8Args);
+    // Works with both std::vector and V8::EventArgs
+    template<class T>
+    void MValueArgsToV8(const alt::MValueArgs& args, T& v8Args)
+    {
+        for(uint64_t i = 0; i < args.GetSize(); ++i) v8Args.push_back(MValueToV8(args[i]));
+    }
 
     void SetAccessor(v8::Local<v8::Template> tpl, v8::Isolate* isolate, const char* name, v8::AccessorGetterCallback getter, v8::AccessorSetterCallback setter = nullptr);
 
+    // js-module command options shared by client and server, returns false if args[0] isn't one of them
+    bool HandleSharedCommand(alt::Array<alt::StringView>& args);
+    void PrintSharedCommandHelp();
+
 };  // namespace V8Helpers
 
 class V8ResourceImpl;
 
+namespace alt
+{
+    class IResource;
+}
+
 namespace V8
 {
     template<typename T>
     using CPersistent = v8::Persistent<T, v8::CopyablePersistentTraits<T>>;
 
-    class SourceLocation
+    // Interned file names of the scripts of a resource, indexed by script id.
+    // V8 numbers the scripts of an isolate upwards from 1, so a lookup is a vector index
+    class ScriptNames
     {
     public:
-        SourceLocation(std::string&& fileName, int line, v8::Local<v8::Context> ctx);
+        const std::string* Get(int scriptId) const
+        {
+            if(scriptId <= 0 || (size_t)scriptId >= names.size()) return nullptr;
+
+            return names[scriptId];
+        }
 
-        const std::string& GetFileName() const
+        void Set(int scriptId, const std::string* name)
         {
-            return fileName;
+            if((size_t)scriptId >= names.size()) names.resize(scriptId + 1, nullptr);
+
+            names[scriptId] = name;
+        }
+
+        void Clear()
+        {
+            names.clear();
+            names.shrink_to_fit();
         }
+
+    private:
+        std::vector<const std::string*> names;
+    };
+
+    class SourceLocation
+    {
+    public:
+        enum class CaptureMode : uint8_t
+        {
+            // No stack trace is captured, every location is unknown
+            OFF,
+            // Only the script id and line are captured, the file name is read once per script
+            LAZY,
+            // The file name is read from the stack frame every time
+            FULL
+        };
+
+        // Script ids of locations without a script
+        static constexpr int UnknownScript = 0;
+        static constexpr int EvalScript = -1;
+
+        SourceLocation(const ScriptNames* scripts, int scriptId, int line, alt::IResource* resource);
+
+        // Looked up from the script id, only locations that are printed need the name
+        const std::string& GetFileName() const;
         int GetLineNumber() const
         {
             return line;
@@ -98,12 +162,24 @@ namespace V8
 
         static SourceLocation GetCurrent(v8::Isolate* isolate);
 
+        static void SetCaptureMode(CaptureMode mode);
+        static CaptureMode GetCaptureMode();
+        static bool ParseCaptureMode(std::string_view name, CaptureMode& mode);
+
+        // Forgets the script names of a worker, must be called on its thread when disposing its isolate
+        static void DisposeIsolate(v8::Isolate* isolate);
+
     private:
-        CPersistent<v8::Context> context;
-        std::string fileName;
+        // Not set inside of workers
+        alt::IResource* resource = nullptr;
+        // Owned by the resource, or by the thread of a worker
+        const ScriptNames* scripts = nullptr;
+        int scriptId = UnknownScript;
         int line = 0;
     };
 
+    class EventHandlerTable;
+
     struct EventCallback
     {
         v8::UniquePersistent<v8::Function> fn;
@@ -111,22 +187,144 @@ namespace V8
         bool removed = false;
         bool once;
 
+        // Set when subscribed, so removals can be reported to the table
+        EventHandlerTable* table = nullptr;
+        uint32_t eventId = 0;
+
         EventCallback(v8::Isolate* isolate, v8::Local<v8::Function> _fn, SourceLocation&& location, bool once = false) : fn(isolate, _fn), location(std::move(location)), once(once) {}
+
+        // Marks the callback as removed, it is freed by the next compaction of its table
+        void Remove();
+    };
+
+    // Arguments of an event, stored on top of the resource's argument stack.
+    // The stack keeps its capacity between events, so building the arguments doesn't allocate
+    // and nested dispatches (e.g. alt.emit from a handler) push their own frame above this one.
+    class EventArgs
+    {
+    public:
+        EventArgs(std::vector<v8::Local<v8::Value>>& _stack) : stack(_stack), base(_stack.size()), first(_stack.size()) {}
+        EventArgs(const EventArgs&) = delete;
+
+        ~EventArgs()
+        {
+            stack.resize(base);
+        }
+
+        void push_back(v8::Local<v8::Value> val)
+        {
+            stack.push_back(val);
+        }
+
+        // Drops the first argument without moving the others
+        void Shift()
+        {
+            if(first < stack.size()) ++first;
+        }
+
+        // Drops the arguments after the first size ones
+        void Resize(size_t size)
+        {
+            stack.resize(first + size);
+        }
+
+        size_t size() const
+        {
+            return stack.size() - first;
+        }
+
+        bool HasObjects() const
+        {
+            for(size_t i = first; i < stack.size(); ++i)
+                if(stack[i]->IsObject()) return true;
+
+            return false;
+        }
+
+        // Only valid until the next push to the stack, fetch it again for every call
+        v8::Local<v8::Value>* data()
+        {
+            return stack.data() + first;
+        }
+
+        v8::Local<v8::Value>& operator[](size_t idx)
+        {
+            return stack[first + idx];
+        }
+
+    private:
+        std::vector<v8::Local<v8::Value>>& stack;
+        size_t base;
+        size_t first;
+    };
+
+    // Converts the arguments of an event that is delivered to every resource of the isolate.
+    // The first resource converts them as usual, from the second one on primitives and dictionary
+    // keys are created once and shared, only containers and context bound values are created per resource
+    class MValueArgsCache
+    {
+    public:
+        MValueArgsCache() = default;
+        MValueArgsCache(const MValueArgsCache&) = delete;
+
+        void Convert(const alt::MValueArgs& args, EventArgs& v8Args);
+
+        // Always creates the arguments from the cache, for handlers in a context that already
+        // received them which must not share its objects with the previous handlers
+        void Materialize(const alt::MValueArgs& args, EventArgs& v8Args);
+
+        // Releases the cached values, must be called before the isolate is disposed
+        void Clear();
+
+    private:
+        struct Node
+        {
+            enum class Type : uint8_t
+            {
+                PRIMITIVE,
+                LIST,
+                DICT,
+                MVALUE
+            };
+
+            Type type = Type::PRIMITIVE;
+            uint32_t size = 0;
+            // Index of the first key of a dict in keys
+            uint32_t keysOffset = 0;
+            v8::Global<v8::Value> value;
+            // Values bound to the context of a resource, e.g. entities and vectors
+            alt::MValueConst mvalue;
+        };
+
+        bool Matches(v8::Isolate* isolate, const alt::MValueArgs& args);
+        void Build(alt::MValueConst val);
+        v8::Local<v8::Value> Materialize(v8::Local<v8::Value> objectProto, size_t& idx);
+
+        v8::Isolate* isolate = nullptr;
+        // Keeps the MValues alive, so their addresses identify the arguments
+        alt::MValueArgs args;
+        bool built = false;
+
+        std::vector<Node> nodes;
+        std::vector<v8::Global<v8::Name>> keys;
+
+        std::vector<v8::Local<v8::Value>> values;
+        std::vector<v8::Local<v8::Name>> names;
     };
 
     class EventHandler
     {
     public:
-        using CallbacksGetter = std::function<std::vector<EventCallback*>(V8ResourceImpl* resource, const alt::CEvent*)>;
-        using ArgsGetter = std::function<void(V8ResourceImpl* resource, const alt::CEvent*, std::vector<v8::Local<v8::Value>>& args)>;
+        using CallbacksGetter = std::function<const std::vector<EventCallback*>&(V8ResourceImpl* resource, const alt::CEvent*)>;
+        using ArgsGetter = std::function<void(V8ResourceImpl* resource, const alt::CEvent*, EventArgs& args)>;
 
         EventHandler(alt::CEvent::Type type, CallbacksGetter&& _handlersGetter, ArgsGetter&& _argsGetter);
 
         // Temp issue fix for https://stackoverflow.com/questions/9459980/c-global-variable-not-initialized-when-linked-through-static-libraries-but-ok
         void Reference();
 
-        std::vector<V8::EventCallback*> GetCallbacks(V8ResourceImpl* impl, const alt::CEvent* e);
-        std::vector<v8::Local<v8::Value>> GetArgs(V8ResourceImpl* impl, const alt::CEvent* e);
+        const std::vector<V8::EventCallback*>& GetCallbacks(V8ResourceImpl* impl, const alt::CEvent* e);
+        void GetArgs(V8ResourceImpl* impl, const alt::CEvent* e, EventArgs& args);
 
         static EventHandler* Get(const alt::CEvent* e);
 
@@ -169,7 +367,44 @@ namespace V8
 
     void SetAccessor(v8::Isolate* isolate, v8::Local<v8::FunctionTemplate> tpl, const char* name, v8::AccessorGetterCallback getter, v8::AccessorSetterCallback setter = nullptr);
 
+    // Accessor on the instance template, so the property is an own property of every instance
+    void SetInstanceAccessor(v8::Isolate* isolate, v8::Local<v8::FunctionTemplate> tpl, const char* name, v8::AccessorGetterCallback getter);
+
+    // Returns the number stored in an internal field, used for the components of Vector3, Vector2 and RGBA
+    template<int Index>
+    void NumberFieldGetter(v8::Local<v8::String>, const v8::PropertyCallbackInfo<v8::Value>& info)
+    {
+        info.GetReturnValue().Set(info.Holder()->GetInternalField(Index));
+    }
+
+    inline double GetNumberField(v8::Local<v8::Object> obj, int index)
+    {
+        return obj->GetInternalField(index).As<v8::Number>()->Value();
+    }
+
+    // Start of the elements of a typed array
+    inline void* GetTypedArrayData(v8::Local<v8::TypedArray> arr)
+    {
+        return static_cast<uint8_t*>(arr->Buffer()->GetBackingStore()->Data()) + arr->ByteOffset();
+    }
+
     void SetMethod(v8::Isolate* isolate, v8::Local<v8::FunctionTemplate> tpl, const char* name, v8::FunctionCallback callback);
+    void SetFastMethod(v8::Isolate* isolate, v8::Local<v8::FunctionTemplate> tpl, const char* name, v8::FunctionCallback callback, const v8::CFunction* fastCallback);
+
+#ifdef V8_FAST_API_CALLS
+    // Fast callbacks take the receiver first and may end with a v8::FastApiCallbackOptions&.
+    // They must not allocate, throw or call into V8, options.fallback = true reruns the call through the slow callback
+    template<auto Fn>
+    const v8::CFunction* FastCallback()
+    {
+        static const v8::CFunction _cfunction = v8::CFunction::Make(Fn);
+        return &_cfunction;
+    }
+
+    #define V8_FAST_CALLBACK(...) (V8::FastCallback<&__VA_ARGS__>())
+#else
+    #define V8_FAST_CALLBACK(...) nullptr
+#endif
 
     void SetStaticAccessor(v8::Isolate* isolate, v8::Local<v8::FunctionTemplate> tpl, const char* name, v8::AccessorGetterCallback getter, v8::AccessorSetterCallback setter = nullptr);
 
@@ -204,6 +439,9 @@ namespace V8
     bool SafeToRGBA(v8::Local<v8::Value> val, v8::Local<v8::Context> ctx, alt::RGBA& out);
     bool SafeToVector3(v8::Local<v8::Value> val, v8::Local<v8::Context> ctx, alt::Vector3f& out);
     bool SafeToVector2(v8::Local<v8::Value> val, v8::Local<v8::Context> ctx, alt::Vector2f& out);
+    // Read the internal fields of Vector3/Vector2 instances and the properties of any other object
+    bool SafeToXYZ(v8::Local<v8::Object> obj, v8::Local<v8::Context> ctx, double& x, double& y, double& z);
+    bool SafeToXY(v8::Local<v8::Object> obj, v8::Local<v8::Context> ctx, double& x, double& y);
     bool SafeToArrayBuffer(v8::Local<v8::Value> val, v8::Local<v8::Context> ctx, v8::Local<v8::ArrayBuffer>& out);
     bool SafeToArrayBufferView(v8::Local<v8::Value> val, v8::Local<v8::Context> ctx, v8::Local<v8::ArrayBufferView>& out);
     bool SafeToArray(v8::Local<v8::Value> val, v8::Local<v8::Context> ctx, v8::Local<v8::Array>& out);
@@ -396,6 +634,14 @@ namespace V8
     double val;                  \
     V8_CHECK(V8::SafeToNumber((v8Val), ctx, val), "Failed to convert value to number")
 
+#define V8_TO_XYZ(v8Obj, x, y, z) \
+    double x, y, z;               \
+    V8_CHECK(V8::SafeToXYZ((v8Obj), ctx, x, y, z), "Failed to convert value to number")
+
+#define V8_TO_XY(v8Obj, x, y) \
+    double x, y;              \
+    V8_CHECK(V8::SafeToXY((v8Obj), ctx, x, y), "Failed to convert value to number")
+
 #define V8_TO_INTEGER(v8Val, val) \
     int64_t val;                  \
     V8_CHECK(V8::SafeToInteger((v8Val), ctx, val), "Failed to convert value to integer")
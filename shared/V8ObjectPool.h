@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace V8
+{
+    // Free list allocator for objects that are created and destroyed often.
+    // Memory is allocated in blocks of BlockSize objects and kept for the lifetime of the process,
+    // the pool is not thread safe and must only be used from the main thread
+    template<class T, size_t BlockSize = 64>
+    class ObjectPool
+    {
+    public:
+        ObjectPool() = default;
+        ObjectPool(const ObjectPool&) = delete;
+
+        void* Allocate()
+        {
+            if(!freeList) Grow();
+
+            Slot* slot = freeList;
+            freeList = slot->next;
+            return slot;
+        }
+
+        void Free(void* ptr)
+        {
+            if(!ptr) return;
+
+            Slot* slot = static_cast<Slot*>(ptr);
+            slot->next = freeList;
+            freeList = slot;
+        }
+
+    private:
+        union Slot
+        {
+            Slot* next;
+            alignas(T) unsigned char storage[sizeof(T)];
+        };
+
+        void Grow()
+        {
+            Slot* block = static_cast<Slot*>(::operator new(sizeof(Slot) * BlockSize));
+            blocks.push_back(block);
+
+            for(size_t i = BlockSize; i > 0; --i)
+            {
+                block[i - 1].next = freeList;
+                freeList = &block[i - 1];
+            }
+        }
+
+        Slot* freeList = nullptr;
+        std::vector<Slot*> blocks;
+    };
+}  // namespace V8
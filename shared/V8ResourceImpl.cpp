@@ -13,84 +13,169 @@ using namespace alt;
 
 V8ResourceImpl::~V8ResourceImpl()
 {
-    for(auto& [obj, ent] : entities)
-    {
-        delete ent;
-    }
+    entities.ForEach([](alt::IBaseObject*, V8Entity* ent) { delete ent; });
+    entities.Clear();
 
-    entities.clear();
+    ClearTimers();
 }
 
 extern V8Class v8Vector3, v8Vector2, v8RGBA, v8BaseObject;
 bool V8ResourceImpl::Start()
 {
-    vector3Class.Reset(isolate, v8Vector3.JSValue(isolate, GetContext()));
-    vector2Class.Reset(isolate, v8Vector2.JSValue(isolate, GetContext()));
-    rgbaClass.Reset(isolate, v8RGBA.JSValue(isolate, GetContext()));
     baseObjectClass.Reset(isolate, v8BaseObject.JSValue(isolate, GetContext()));
 
+    vector3Template.Reset(isolate, v8Vector3.GetTemplate(isolate));
+    vector2Template.Reset(isolate, v8Vector2.GetTemplate(isolate));
+    rgbaTemplate.Reset(isolate, v8RGBA.GetTemplate(isolate));
+    baseObjectTemplate.Reset(isolate, v8BaseObject.GetTemplate(isolate));
+
     return true;
 }
 
 void V8ResourceImpl::OnTick()
 {
-    for(auto& id : oldTimers) timers.erase(id);
+    FreeRemovedTimers();
+    ++timerTicks;
 
-    oldTimers.clear();
+    int64_t time = GetTime();
 
-    for(auto& p : timers)
+    // Timers created while running are appended, they run from the next tick on
+    size_t count = everyTickTimers.size();
+    for(size_t i = 0; i < count; ++i)
     {
-        int64_t time = GetTime();
+        auto [id, timer] = everyTickTimers[i];
+        if(timer->IsRemoved()) continue;
 
-        if(!p.second->Update(time)) RemoveTimer(p.first);
+        time = RunTimer(id, timer, time);
+    }
 
-        if(GetTime() - time > 10)
-        {
-            auto& location = p.second->GetLocation();
+    // Only the timers that are due are touched, each of them runs at most once per tick
+    int64_t now = time;
+    while(!scheduledTimers.empty() && scheduledTimers.front().nextRun <= now)
+    {
+        std::pop_heap(scheduledTimers.begin(), scheduledTimers.end(), ScheduledTimer::Later);
+        uint32_t id = scheduledTimers.back().id;
+        scheduledTimers.pop_back();
 
-            if(location.GetLineNumber() != 0)
-            {
-                Log::Warning << "Timer at " << resource->GetName() << ":" << location.GetFileName() << ":" << location.GetLineNumber() << " was too long " << GetTime() - time << "ms"
-                             << Log::Endl;
-            }
-            else
-            {
-                Log::Warning << "Timer at " << resource->GetName() << ":" << location.GetFileName() << " was too long " << GetTime() - time << "ms" << Log::Endl;
-            }
+        auto it = timers.find(id);
+        if(it == timers.end())
+        {
+            --clearedScheduledTimers;
+            continue;
         }
-    }
 
-    for(auto it = localHandlers.begin(); it != localHandlers.end();)
-    {
-        if(it->second.removed) it = localHandlers.erase(it);
+        V8Timer* timer = it->second;
+        time = RunTimer(id, timer, time);
+
+        if(!timer->IsRemoved()) ScheduleTimer(id, timer->GetNextRun());
         else
-            ++it;
+            --clearedScheduledTimers;  // Wasn't queued while running
     }
 
-    for(auto it = remoteHandlers.begin(); it != remoteHandlers.end();)
+    localHandlers.Compact();
+    remoteHandlers.Compact();
+    localGenericHandlers.Compact();
+    remoteGenericHandlers.Compact();
+
+    promiseRejections.ProcessQueue(this);
+}
+
+int64_t V8ResourceImpl::RunTimer(uint32_t id, V8Timer* timer, int64_t time)
+{
+    if(V8::EventStats::IsEnabled())
     {
-        if(it->second.removed) it = remoteHandlers.erase(it);
-        else
-            ++it;
+        int64_t start = V8::EventStats::Now();
+        if(!timer->Update(time, GetContext())) RemoveTimer(id);
+
+        // Removed timers are only freed on the next tick
+        auto& location = timer->GetLocation();
+        stats.RecordTimer(location.GetFileName(), location.GetLineNumber(), V8::EventStats::Now() - start);
     }
+    else if(!timer->Update(time, GetContext()))
+        RemoveTimer(id);
+
+    ++timerRuns;
 
-    for(auto it = localGenericHandlers.begin(); it != localGenericHandlers.end(); it++)
+    int64_t end = GetTime();
+    if(end - time > 10)
     {
-        if(it->removed) localGenericHandlers.erase(it);
+        auto& location = timer->GetLocation();
+
+        if(location.GetLineNumber() != 0)
+        {
+            Log::Warning << "Timer at " << resource->GetName() << ":" << location.GetFileName() << ":" << location.GetLineNumber() << " was too long " << end - time << "ms" << Log::Endl;
+        }
+        else
+        {
+            Log::Warning << "Timer at " << resource->GetName() << ":" << location.GetFileName() << " was too long " << end - time << "ms" << Log::Endl;
+        }
     }
 
-    for(auto it = remoteGenericHandlers.begin(); it != remoteGenericHandlers.end(); it++)
+    return end;
+}
+
+void V8ResourceImpl::FreeRemovedTimers()
+{
+    if(oldTimers.empty()) return;
+
+    auto it = std::remove_if(everyTickTimers.begin(), everyTickTimers.end(), [](auto& pair) { return pair.second->IsRemoved(); });
+    everyTickTimers.erase(it, everyTickTimers.end());
+
+    for(auto timer : oldTimers) delete timer;
+    oldTimers.clear();
+
+    // Rebuild the queue once most of its entries belong to cleared timers
+    if(clearedScheduledTimers > scheduledTimers.size() / 2)
     {
-        if(it->removed) remoteGenericHandlers.erase(it);
+        auto cleared = std::remove_if(scheduledTimers.begin(), scheduledTimers.end(), [this](const ScheduledTimer& entry) { return timers.count(entry.id) == 0; });
+        scheduledTimers.erase(cleared, scheduledTimers.end());
+        std::make_heap(scheduledTimers.begin(), scheduledTimers.end(), ScheduledTimer::Later);
+
+        clearedScheduledTimers = 0;
     }
+}
 
-    promiseRejections.ProcessQueue(this);
+void V8ResourceImpl::ClearTimers()
+{
+    for(auto& [id, timer] : timers) delete timer;
+    for(auto timer : oldTimers) delete timer;
+
+    timers.clear();
+    oldTimers.clear();
+    everyTickTimers.clear();
+    scheduledTimers.clear();
+    clearedScheduledTimers = 0;
+}
+
+void V8ResourceImpl::DumpEventStats()
+{
+    auto print = [this](const std::string& name, const V8::LatencyHistogram& histogram) {
+        Log::Info << resource->GetName() << ": " << name << ": " << histogram.GetCount() << " calls, p50 " << histogram.GetPercentile(50) / 1000.0 << "ms, p99 "
+                  << histogram.GetPercentile(99) / 1000.0 << "ms, max " << histogram.GetMax() / 1000.0 << "ms" << Log::Endl;
+    };
+
+    for(auto& [id, histogram] : stats.GetEvents()) print("event " + V8::EventIds::GetName(id), histogram);
+    if(stats.GetGenericEvents().GetCount() != 0) print("generic event handlers", stats.GetGenericEvents());
+    for(auto& [key, histogram] : stats.GetTimers()) print("timer " + *key.fileName + ":" + std::to_string(key.line), histogram);
 }
 
 void V8ResourceImpl::BindEntity(v8::Local<v8::Object> val, alt::Ref<alt::IBaseObject> handle)
 {
     V8Entity* ent = new V8Entity(GetContext(), V8Entity::GetClass(handle), val, handle);
-    entities.insert({ handle.Get(), ent });
+    ent->SetSlot(entities.Insert(handle.Get(), ent));
+    if(V8Entity::IsWeakEnabled()) ent->SetWeak(this, &OnEntityCollected);
+}
+
+void V8ResourceImpl::OnEntityCollected(const v8::WeakCallbackInfo<V8Entity>& data)
+{
+    V8Entity* ent = data.GetParameter();
+    ent->ResetJSVal();
+
+    V8ResourceImpl* resource = ent->GetWeakOwner();
+    resource->entities.Remove(ent->GetSlot());
+
+    resource->collectedEntities += 1;
+    delete ent;
 }
 
 v8::Local<v8::Value> V8ResourceImpl::GetBaseObjectOrNull(alt::IBaseObject* handle)
@@ -105,58 +190,61 @@ v8::Local<v8::Value> V8ResourceImpl::GetBaseObjectOrNull(alt::IBaseObject* handl
     }
 }
 
+// Instances are filled directly instead of going through the JS constructors,
+// the components don't need to be validated here
 v8::Local<v8::Value> V8ResourceImpl::CreateVector3(alt::Vector3f vec)
 {
-    std::vector<v8::Local<v8::Value>> args{ V8::JSValue(vec[0]), V8::JSValue(vec[1]), V8::JSValue(vec[2]) };
+    v8::Local<v8::Object> obj = vector3Template.Get(isolate)->InstanceTemplate()->NewInstance(GetContext()).ToLocalChecked();
+    obj->SetInternalField(0, V8::JSValue(vec[0]));
+    obj->SetInternalField(1, V8::JSValue(vec[1]));
+    obj->SetInternalField(2, V8::JSValue(vec[2]));
 
-    return v8Vector3.CreateInstance(isolate, GetContext(), args);
+    return obj;
 }
 
 v8::Local<v8::Value> V8ResourceImpl::CreateVector2(alt::Vector2f vec)
 {
-    std::vector<v8::Local<v8::Value>> args{ V8::JSValue(vec[0]), V8::JSValue(vec[1]) };
+    v8::Local<v8::Object> obj = vector2Template.Get(isolate)->InstanceTemplate()->NewInstance(GetContext()).ToLocalChecked();
+    obj->SetInternalField(0, V8::JSValue(vec[0]));
+    obj->SetInternalField(1, V8::JSValue(vec[1]));
 
-    return v8Vector2.CreateInstance(isolate, GetContext(), args);
+    return obj;
 }
 
 v8::Local<v8::Value> V8ResourceImpl::CreateRGBA(alt::RGBA rgba)
 {
-    std::vector<v8::Local<v8::Value>> args{ V8::JSValue(rgba.r), V8::JSValue(rgba.g), V8::JSValue(rgba.b), V8::JSValue(rgba.a) };
+    v8::Local<v8::Object> obj = rgbaTemplate.Get(isolate)->InstanceTemplate()->NewInstance(GetContext()).ToLocalChecked();
+    obj->SetInternalField(0, V8::JSValue((uint32_t)rgba.r));
+    obj->SetInternalField(1, V8::JSValue((uint32_t)rgba.g));
+    obj->SetInternalField(2, V8::JSValue((uint32_t)rgba.b));
+    obj->SetInternalField(3, V8::JSValue((uint32_t)rgba.a));
 
-    return V8::New(isolate, GetContext(), rgbaClass.Get(isolate), args);
+    return obj;
 }
 
 bool V8ResourceImpl::IsVector3(v8::Local<v8::Value> val)
 {
-    bool result = false;
-    val->InstanceOf(GetContext(), vector3Class.Get(isolate)).To(&result);
-    return result;
+    return vector3Template.Get(isolate)->HasInstance(val);
 }
 
 bool V8ResourceImpl::IsVector2(v8::Local<v8::Value> val)
 {
-    bool result = false;
-    val->InstanceOf(GetContext(), vector2Class.Get(isolate)).To(&result);
-    return result;
+    return vector2Template.Get(isolate)->HasInstance(val);
 }
 
 bool V8ResourceImpl::IsRGBA(v8::Local<v8::Value> val)
 {
-    bool result = false;
-    val->InstanceOf(GetContext(), rgbaClass.Get(isolate)).To(&result);
-    return result;
+    return rgbaTemplate.Get(isolate)->HasInstance(val);
 }
 
 bool V8ResourceImpl::IsBaseObject(v8::Local<v8::Value> val)
 {
-    bool result = false;
-    val->InstanceOf(GetContext(), baseObjectClass.Get(isolate)).To(&result);
-    return result;
+    return baseObjectTemplate.Get(isolate)->HasInstance(val);
 }
 
 void V8ResourceImpl::OnCreateBaseObject(alt::Ref<alt::IBaseObject> handle)
 {
-    Log::Debug << "OnCreateBaseObject " << handle.Get() << " " << (entities.find(handle.Get()) != entities.end()) << Log::Endl;
+    Log::Debug << "OnCreateBaseObject " << handle.Get() << " " << (entities.Get(handle.Get()) != nullptr) << Log::Endl;
 
     /*if (entities.find(handle.Get()) == entities.end())
     {
@@ -168,132 +256,81 @@ void V8ResourceImpl::OnCreateBaseObject(alt::Ref<alt::IBaseObject> handle)
             CreateEntity(handle.Get());
     }*/
 
-    NotifyPoolUpdate(handle.Get());
+    NotifyPoolUpdate(handle.Get(), false);
 }
 
 void V8ResourceImpl::OnRemoveBaseObject(alt::Ref<alt::IBaseObject> handle)
 {
-    NotifyPoolUpdate(handle.Get());
+    NotifyPoolUpdate(handle.Get(), true);
 
     v8::Locker locker(isolate);
     v8::Isolate::Scope isolateScope(isolate);
     v8::HandleScope handleScope(isolate);
     v8::Context::Scope scope(GetContext());
 
-    V8Entity* ent = GetEntity(handle.Get());
+    V8Entity* ent = entities.Remove(handle.Get());
 
     if(!ent) return;
 
-    entities.erase(handle.Get());
-
-    // TODO: ent->SetWeak();
-    ent->GetJSVal(isolate)->SetInternalField(0, v8::External::New(isolate, nullptr));
+    ent->GetJSVal(isolate)->SetAlignedPointerInInternalField(V8Entity::EntityField, nullptr);
     delete ent;
 }
 
-void V8ResourceImpl::NotifyPoolUpdate(alt::IBaseObject* ent)
+V8::BaseObjectPool* V8ResourceImpl::GetPool(alt::IBaseObject::Type type)
 {
-    switch(ent->GetType())
+    switch(type)
     {
-        case alt::IBaseObject::Type::PLAYER: playerPoolDirty = true; break;
-        case alt::IBaseObject::Type::VEHICLE: vehiclePoolDirty = true; break;
+        case alt::IBaseObject::Type::PLAYER: return &players;
+        case alt::IBaseObject::Type::VEHICLE: return &vehicles;
+        case alt::IBaseObject::Type::BLIP: return &blips;
+        default: return nullptr;
     }
 }
 
-v8::Local<v8::Array> V8ResourceImpl::GetAllPlayers()
+void V8ResourceImpl::NotifyPoolUpdate(alt::IBaseObject* ent, bool removed)
 {
-    if(playerPoolDirty)
-    {
-        playerPoolDirty = false;
-
-        Array<Ref<IPlayer>> all = ICore::Instance().GetPlayers();
-        v8::Local<v8::Array> jsAll = v8::Array::New(isolate, all.GetSize());
-
-        for(uint32_t i = 0; i < all.GetSize(); ++i) jsAll->Set(GetContext(), i, GetBaseObjectOrNull(all[i]));
+    V8::BaseObjectPool* pool = GetPool(ent->GetType());
+    if(!pool) return;
 
-        players.Reset(isolate, jsAll);
-        return jsAll;
-    }
-
-    return players.Get(isolate);
+    if(removed)
+        pool->Remove(ent);
+    else
+        pool->Add(ent);
 }
 
-v8::Local<v8::Array> V8ResourceImpl::GetAllBlips()
+v8::Local<v8::Array> V8ResourceImpl::GetAllPlayers()
 {
-    Array<Ref<IBlip>> all = ICore::Instance().GetBlips();
-    v8::Local<v8::Array> jsAll = v8::Array::New(isolate, all.GetSize());
-
-    for(uint32_t i = 0; i < all.GetSize(); ++i) jsAll->Set(GetContext(), i, GetBaseObjectOrNull(all[i]));
+    if(!players.IsInitialized()) players.Init(ICore::Instance().GetPlayers());
 
-    return jsAll;
+    return players.GetArray(isolate, GetContext(), [this](alt::IBaseObject* handle) { return GetBaseObjectOrNull(handle); });
 }
 
-v8::Local<v8::Array> V8ResourceImpl::GetAllVehicles()
-{
-    if(vehiclePoolDirty)
-    {
-        vehiclePoolDirty = false;
-
-        Array<Ref<IVehicle>> all = ICore::Instance().GetVehicles();
-        v8::Local<v8::Array> jsAll = v8::Array::New(isolate, all.GetSize());
-
-        for(uint32_t i = 0; i < all.GetSize(); ++i) jsAll->Set(GetContext(), i, GetBaseObjectOrNull(all[i]));
-
-        vehicles.Reset(isolate, jsAll);
-        return jsAll;
-    }
-
-    return vehicles.Get(isolate);
-}
-
-std::vector<V8::EventCallback*> V8ResourceImpl::GetLocalHandlers(const std::string& name)
+v8::Local<v8::Array> V8ResourceImpl::GetAllBlips()
 {
-    std::vector<V8::EventCallback*> handlers;
-    auto range = localHandlers.equal_range(name);
-
-    for(auto it = range.first; it != range.second; ++it) handlers.push_back(&it->second);
+    if(!blips.IsInitialized()) blips.Init(ICore::Instance().GetBlips());
 
-    return handlers;
+    return blips.GetArray(isolate, GetContext(), [this](alt::IBaseObject* handle) { return GetBaseObjectOrNull(handle); });
 }
 
-std::vector<V8::EventCallback*> V8ResourceImpl::GetRemoteHandlers(const std::string& name)
+v8::Local<v8::Array> V8ResourceImpl::GetAllVehicles()
 {
-    std::vector<V8::EventCallback*> handlers;
-    auto range = remoteHandlers.equal_range(name);
-
-    for(auto it = range.first; it != range.second; ++it) handlers.push_back(&it->second);
+    if(!vehicles.IsInitialized()) vehicles.Init(ICore::Instance().GetVehicles());
 
-    return handlers;
+    return vehicles.GetArray(isolate, GetContext(), [this](alt::IBaseObject* handle) { return GetBaseObjectOrNull(handle); });
 }
 
-std::vector<V8::EventCallback*> V8ResourceImpl::GetGenericHandlers(bool local)
+void V8ResourceImpl::InvokeEventHandlers(const alt::CEvent* ev, const std::vector<V8::EventCallback*>& handlers, V8::EventArgs& args)
 {
-    std::vector<V8::EventCallback*> handlers;
-    if(local)
-    {
-        for(auto& it : localGenericHandlers)
-        {
-            handlers.push_back(&it);
-        }
-    }
-    else
+    // Handlers subscribed while dispatching are appended to the same array,
+    // only invoke the ones that were registered when the event was fired
+    size_t count = handlers.size();
+    for(size_t i = 0; i < count; ++i)
     {
-        for(auto& it : remoteGenericHandlers)
-        {
-            handlers.push_back(&it);
-        }
-    }
-    return handlers;
-}
-
-void V8ResourceImpl::InvokeEventHandlers(const alt::CEvent* ev, const std::vector<V8::EventCallback*>& handlers, std::vector<v8::Local<v8::Value>>& args)
-{
-    for(auto handler : handlers)
-    {
-        int64_t time = GetTime();
-
+        V8::EventCallback* handler = handlers[i];
         if(handler->removed) continue;
 
+        int64_t start = V8::EventStats::Now();
+
         V8Helpers::TryCatch([&] {
             v8::MaybeLocal<v8::Value> retn = handler->fn.Get(isolate)->Call(GetContext(), v8::Undefined(isolate), args.size(), args.data());
 
@@ -304,20 +341,29 @@ void V8ResourceImpl::InvokeEventHandlers(const alt::CEvent* ev, const std::vecto
             return true;
         });
 
-        if(GetTime() - time > 5)
+        int64_t elapsed = V8::EventStats::Now() - start;
+        if(V8::EventStats::IsEnabled())
+        {
+            if(handler->table == &localGenericHandlers || handler->table == &remoteGenericHandlers) stats.RecordGenericEvent(elapsed);
+            else
+                stats.RecordEvent(handler->eventId, elapsed);
+        }
+
+        int64_t elapsedMs = elapsed / 1000000;
+        if(elapsedMs > 5)
         {
             if(handler->location.GetLineNumber() != 0)
             {
                 Log::Warning << "Event handler at " << resource->GetName() << ":" << handler->location.GetFileName() << ":" << handler->location.GetLineNumber() << " was too long "
-                             << (GetTime() - time) << "ms" << Log::Endl;
+                             << elapsedMs << "ms" << Log::Endl;
             }
             else
             {
-                Log::Warning << "Event handler at " << resource->GetName() << ":" << handler->location.GetFileName() << " was too long " << (GetTime() - time) << "ms" << Log::Endl;
+                Log::Warning << "Event handler at " << resource->GetName() << ":" << handler->location.GetFileName() << " was too long " << elapsedMs << "ms" << Log::Endl;
             }
         }
 
-        if(handler->once) handler->removed = true;
+        if(handler->once) handler->Remove();
     }
 }
 
@@ -337,7 +383,7 @@ alt::MValue V8ResourceImpl::FunctionImpl::Call(alt::MValueArgs args) const
     node::CallbackScope callbackScope(isolate, nodeRes->GetAsyncResource(), nodeRes->GetAsyncContext());
 #endif  // ALT_SERVER_API
 
-    std::vector<v8::Local<v8::Value>> v8Args;
+    V8::EventArgs v8Args(resource->eventArgs);
     V8Helpers::MValueArgsToV8(args, v8Args);
 
     alt::MValue res;
@@ -2,12 +2,16 @@
 
 #include <chrono>
 #include <filesystem>
+#include <string_view>
 
 #include "cpp-sdk/types/MValue.h"
 #include "cpp-sdk/IResource.h"
 #include "cpp-sdk/objects/IBaseObject.h"
 
+#include "V8BaseObjectPool.h"
 #include "V8Entity.h"
+#include "V8EventStats.h"
+#include "V8EventTable.h"
 #include "V8Timer.h"
 #include "PromiseRejections.h"
 
@@ -41,6 +45,15 @@ public:
 
     void OnTick() override;
 
+    // Whether OnTick has anything to do at the given time, lets idle resources be skipped
+    bool HasTickWork(int64_t now) const
+    {
+        if(!everyTickTimers.empty() || !oldTimers.empty()) return true;
+        if(!scheduledTimers.empty() && scheduledTimers.front().nextRun <= now) return true;
+
+        return localHandlers.IsDirty() || remoteHandlers.IsDirty() || localGenericHandlers.IsDirty() || remoteGenericHandlers.IsDirty() || !promiseRejections.IsEmpty();
+    }
+
     inline alt::IResource* GetResource()
     {
         return resource;
@@ -54,65 +67,49 @@ public:
         return context.Get(isolate);
     }
 
-    void SubscribeLocal(const std::string& ev, v8::Local<v8::Function> cb, V8::SourceLocation&& location, bool once = false)
+    void SubscribeLocal(std::string_view ev, v8::Local<v8::Function> cb, V8::SourceLocation&& location, bool once = false)
     {
-        localHandlers.insert({ ev, V8::EventCallback{ isolate, cb, std::move(location), once } });
+        localHandlers.Subscribe(V8::EventIds::Get(ev), new V8::EventCallback{ isolate, cb, std::move(location), once });
     }
 
-    void SubscribeRemote(const std::string& ev, v8::Local<v8::Function> cb, V8::SourceLocation&& location, bool once = false)
+    void SubscribeRemote(std::string_view ev, v8::Local<v8::Function> cb, V8::SourceLocation&& location, bool once = false)
     {
-        remoteHandlers.insert({ ev, V8::EventCallback{ isolate, cb, std::move(location), once } });
+        remoteHandlers.Subscribe(V8::EventIds::Get(ev), new V8::EventCallback{ isolate, cb, std::move(location), once });
     }
 
     void SubscribeGenericLocal(v8::Local<v8::Function> cb, V8::SourceLocation&& location, bool once = false)
     {
-        localGenericHandlers.push_back(V8::EventCallback{ isolate, cb, std::move(location), once });
+        localGenericHandlers.Subscribe(0, new V8::EventCallback{ isolate, cb, std::move(location), once });
     }
 
     void SubscribeGenericRemote(v8::Local<v8::Function> cb, V8::SourceLocation&& location, bool once = false)
     {
-        remoteGenericHandlers.push_back(V8::EventCallback{ isolate, cb, std::move(location), once });
+        remoteGenericHandlers.Subscribe(0, new V8::EventCallback{ isolate, cb, std::move(location), once });
     }
 
-    void UnsubscribeLocal(const std::string& ev, v8::Local<v8::Function> cb)
+    void UnsubscribeLocal(std::string_view ev, v8::Local<v8::Function> cb)
     {
-        auto range = localHandlers.equal_range(ev);
-
-        for(auto it = range.first; it != range.second; ++it)
-        {
-            if(it->second.fn.Get(isolate)->StrictEquals(cb)) it->second.removed = true;
-        }
+        localHandlers.Unsubscribe(V8::EventIds::Find(ev), isolate, cb);
     }
 
-    void UnsubscribeRemote(const std::string& ev, v8::Local<v8::Function> cb)
+    void UnsubscribeRemote(std::string_view ev, v8::Local<v8::Function> cb)
     {
-        auto range = remoteHandlers.equal_range(ev);
-
-        for(auto it = range.first; it != range.second; ++it)
-        {
-            if(it->second.fn.Get(isolate)->StrictEquals(cb)) it->second.removed = true;
-        }
+        remoteHandlers.Unsubscribe(V8::EventIds::Find(ev), isolate, cb);
     }
 
     void UnsubscribeGenericLocal(v8::Local<v8::Function> cb)
     {
-        for(auto& it : localGenericHandlers)
-        {
-            if(it.fn.Get(isolate)->StrictEquals(cb)) it.removed = true;
-        }
+        localGenericHandlers.Unsubscribe(0, isolate, cb);
     }
 
     void UnsubscribeGenericRemote(v8::Local<v8::Function> cb)
     {
-        for(auto& it : localGenericHandlers)
-        {
-            if(it.fn.Get(isolate)->StrictEquals(cb)) it.removed = true;
-        }
+        remoteGenericHandlers.Unsubscribe(0, isolate, cb);
     }
 
     void DispatchStartEvent(bool error)
     {
-        std::vector<v8::Local<v8::Value>> args;
+        V8::EventArgs args(eventArgs);
         args.push_back(V8::JSValue(error));
 
         InvokeEventHandlers(nullptr, GetLocalHandlers("resourceStart"), args);
@@ -120,23 +117,23 @@ public:
 
     void DispatchStopEvent()
     {
-        std::vector<v8::Local<v8::Value>> args;
+        V8::EventArgs args(eventArgs);
         InvokeEventHandlers(nullptr, GetLocalHandlers("resourceStop"), args);
     }
 
     void DispatchErrorEvent(const std::string& errorMsg, const std::string& file, int32_t line)
     {
-        std::vector<v8::Local<v8::Value>> args = { v8::Exception::Error(V8::JSValue(errorMsg)), V8::JSValue(file), V8::JSValue(line) };
+        V8::EventArgs args(eventArgs);
+        args.push_back(v8::Exception::Error(V8::JSValue(errorMsg)));
+        args.push_back(V8::JSValue(file));
+        args.push_back(V8::JSValue(line));
+
         InvokeEventHandlers(nullptr, GetLocalHandlers("resourceError"), args);
     }
 
     V8Entity* GetEntity(alt::IBaseObject* handle)
     {
-        auto it = entities.find(handle);
-
-        if(it == entities.end()) return nullptr;
-
-        return it->second;
+        return entities.Get(handle);
     }
 
     V8Entity* CreateEntity(alt::IBaseObject* handle)
@@ -144,7 +141,8 @@ public:
         V8Class* _class = V8Entity::GetClass(handle);
 
         V8Entity* ent = new V8Entity(GetContext(), _class, _class->CreateInstance(GetContext()), handle);
-        entities.insert({ handle, ent });
+        ent->SetSlot(entities.Insert(handle, ent));
+        if(V8Entity::IsWeakEnabled()) ent->SetWeak(this, &OnEntityCollected);
         return ent;
     }
 
@@ -187,18 +185,33 @@ public:
         return alt::ICore::Instance().CreateMValueFunction(impl);
     }
 
-    uint32_t CreateTimer(v8::Local<v8::Context> context, v8::Local<v8::Function> callback, uint32_t interval, bool once, V8::SourceLocation&& location)
+    uint32_t CreateTimer(v8::Local<v8::Function> callback, uint32_t interval, bool once, V8::SourceLocation&& location)
     {
         uint32_t id = nextTimerId++;
         // Log::Debug << "Create timer " << id << Log::Endl;
-        timers[id] = new V8Timer{ isolate, context, GetTime(), callback, interval, once, std::move(location) };
+        V8Timer* timer = new V8Timer{ isolate, GetTime(), callback, interval, once, std::move(location) };
+        timers[id] = timer;
+
+        if(interval == 0) everyTickTimers.push_back({ id, timer });
+        else
+            ScheduleTimer(id, timer->GetNextRun());
 
         return id;
     }
 
     void RemoveTimer(uint32_t id)
     {
-        oldTimers.push_back(id);
+        auto it = timers.find(id);
+        if(it == timers.end()) return;
+
+        V8Timer* timer = it->second;
+        timers.erase(it);
+
+        timer->MarkRemoved();
+        oldTimers.push_back(timer);
+
+        // Its entry stays in the queue until it is due or the queue is rebuilt
+        if(timer->GetInterval() != 0) ++clearedScheduledTimers;
     }
 
     void TimerBenchmark()
@@ -216,17 +229,62 @@ public:
 
         Log::Info << GetResource()->GetName() << ": " << totalCount << " running timers (" << everyTickCount << " EveryTick, " << intervalCount << " Interval, " << timeoutCount << " Timeout"
                   << ")" << Log::Endl;
+        Log::Info << GetResource()->GetName() << ": " << everyTickTimers.size() << " timers run every tick, " << scheduledTimers.size() << " queued (" << clearedScheduledTimers
+                  << " cleared), " << timerRuns << " runs in " << timerTicks << " ticks" << Log::Endl;
+        Log::Info << GetResource()->GetName() << ": " << eventArgsSkipped << " event argument conversions avoided" << Log::Endl;
+    }
+
+    void EntityBenchmark()
+    {
+        size_t weakCount = 0, pinnedCount = 0;
+        entities.ForEach([&](alt::IBaseObject*, V8Entity* ent) {
+            if(ent->IsWeak()) weakCount += 1;
+            else if(ent->IsPinned())
+                pinnedCount += 1;
+        });
+
+        Log::Info << GetResource()->GetName() << ": " << entities.GetSize() << " live entity wrappers (" << weakCount << " collectable, " << pinnedCount << " pinned), "
+                  << collectedEntities << " collected" << Log::Endl;
     }
 
-    void NotifyPoolUpdate(alt::IBaseObject* ent);
+    V8::EventStats& GetEventStats()
+    {
+        return stats;
+    }
+
+    void DumpEventStats();
+
+    void NotifyPoolUpdate(alt::IBaseObject* ent, bool removed);
 
     v8::Local<v8::Array> GetAllPlayers();
     v8::Local<v8::Array> GetAllVehicles();
     v8::Local<v8::Array> GetAllBlips();
 
-    std::vector<V8::EventCallback*> GetLocalHandlers(const std::string& name);
-    std::vector<V8::EventCallback*> GetRemoteHandlers(const std::string& name);
-    std::vector<V8::EventCallback*> GetGenericHandlers(bool local);
+    V8::ScriptNames& GetScriptNames()
+    {
+        return scriptNames;
+    }
+
+    const std::vector<V8::EventCallback*>& GetLocalHandlers(uint32_t id)
+    {
+        return localHandlers.Get(id);
+    }
+    const std::vector<V8::EventCallback*>& GetRemoteHandlers(uint32_t id)
+    {
+        return remoteHandlers.Get(id);
+    }
+    const std::vector<V8::EventCallback*>& GetLocalHandlers(std::string_view name)
+    {
+        return localHandlers.Get(V8::EventIds::Find(name));
+    }
+    const std::vector<V8::EventCallback*>& GetRemoteHandlers(std::string_view name)
+    {
+        return remoteHandlers.Get(V8::EventIds::Find(name));
+    }
+    const std::vector<V8::EventCallback*>& GetGenericHandlers(bool local)
+    {
+        return local ? localGenericHandlers.Get(0) : remoteGenericHandlers.Get(0);
+    }
 
     static V8ResourceImpl* Get(v8::Local<v8::Context> ctx)
     {
@@ -243,37 +301,86 @@ protected:
     v8::Isolate* isolate;
     alt::IResource* resource;
 
+    static void OnEntityCollected(const v8::WeakCallbackInfo<V8Entity>& data);
+
     V8::CPersistent<v8::Context> context;
 
-    std::unordered_map<alt::IBaseObject*, V8Entity*> entities;
+    V8::EntityTable entities;
+    // Weak wrappers that were collected and will be recreated on their next access
+    uint64_t collectedEntities = 0;
     std::unordered_map<uint32_t, V8Timer*> timers;
 
-    std::unordered_multimap<std::string, V8::EventCallback> localHandlers;
-    std::unordered_multimap<std::string, V8::EventCallback> remoteHandlers;
-    std::vector<V8::EventCallback> localGenericHandlers;
-    std::vector<V8::EventCallback> remoteGenericHandlers;
+    V8::EventHandlerTable localHandlers;
+    V8::EventHandlerTable remoteHandlers;
+    // Generic handlers are all stored under id 0
+    V8::EventHandlerTable localGenericHandlers;
+    V8::EventHandlerTable remoteGenericHandlers;
+
+    // Backing storage of V8::EventArgs, reused by every event of this resource
+    std::vector<v8::Local<v8::Value>> eventArgs;
+    // Events whose arguments were not converted, either because no live callback
+    // was subscribed or because generic and specific handlers shared them
+    uint64_t eventArgsSkipped = 0;
 
     uint32_t nextTimerId = 0;
-    std::vector<uint32_t> oldTimers;
+    std::vector<V8Timer*> oldTimers;
 
-    bool playerPoolDirty = true;
-    v8::UniquePersistent<v8::Array> players;
+    struct ScheduledTimer
+    {
+        int64_t nextRun;
+        uint32_t id;
+
+        // Comparator of the min-heap, timers due at the same time run in creation order
+        static bool Later(const ScheduledTimer& a, const ScheduledTimer& b)
+        {
+            return (a.nextRun != b.nextRun) ? (a.nextRun > b.nextRun) : (a.id > b.id);
+        }
+    };
+
+    // Timers with an interval of 0 run every tick and don't need to be scheduled
+    std::vector<std::pair<uint32_t, V8Timer*>> everyTickTimers;
+    std::vector<ScheduledTimer> scheduledTimers;
+    size_t clearedScheduledTimers = 0;
+
+    uint64_t timerTicks = 0;
+    uint64_t timerRuns = 0;
 
-    bool vehiclePoolDirty = true;
-    v8::UniquePersistent<v8::Array> vehicles;
+    V8::EventStats stats;
+    // File names of the source locations captured in this resource
+    V8::ScriptNames scriptNames;
+
+    void ScheduleTimer(uint32_t id, int64_t nextRun)
+    {
+        scheduledTimers.push_back({ nextRun, id });
+        std::push_heap(scheduledTimers.begin(), scheduledTimers.end(), ScheduledTimer::Later);
+    }
+
+    int64_t RunTimer(uint32_t id, V8Timer* timer, int64_t time);
+    void FreeRemovedTimers();
+    void ClearTimers();
+
+    V8::BaseObjectPool players;
+    V8::BaseObjectPool vehicles;
+    V8::BaseObjectPool blips;
+
+    V8::BaseObjectPool* GetPool(alt::IBaseObject::Type type);
 
     V8::PromiseRejections promiseRejections;
 
-    V8::CPersistent<v8::Function> vector3Class;
-    V8::CPersistent<v8::Function> vector2Class;
-    V8::CPersistent<v8::Function> rgbaClass;
     V8::CPersistent<v8::Function> baseObjectClass;
 
+    // Used for brand checks of native objects, see V8Class::HasInstance,
+    // and to create Vector3, Vector2 and RGBA instances without calling their constructors
+    V8::CPersistent<v8::FunctionTemplate> vector3Template;
+    V8::CPersistent<v8::FunctionTemplate> vector2Template;
+    V8::CPersistent<v8::FunctionTemplate> rgbaTemplate;
+    V8::CPersistent<v8::FunctionTemplate> baseObjectTemplate;
+
     // TEMP
     static int64_t GetTime()
     {
         return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
     }
 
-    void InvokeEventHandlers(const alt::CEvent* ev, const std::vector<V8::EventCallback*>& handlers, std::vector<v8::Local<v8::Value>>& args);
+    void InvokeEventHandlers(const alt::CEvent* ev, const std::vector<V8::EventCallback*>& handlers, V8::EventArgs& args);
 };
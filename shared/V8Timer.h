@@ -1,23 +1,25 @@
 #pragma once
 
 #include "V8Helpers.h"
+#include "V8ObjectPool.h"
 #include "V8ResourceImpl.h"
 
 class V8Timer
 {
 public:
-    V8Timer(v8::Isolate* _isolate, v8::Local<v8::Context> _context, int64_t curTime, v8::Local<v8::Function> _callback, uint32_t _interval, bool _once, V8::SourceLocation&& _location)
-        : isolate(_isolate), context(_isolate, _context), lastRun(curTime), callback(_isolate, _callback), interval(_interval), once(_once), location(std::move(_location))
+    V8Timer(v8::Isolate* _isolate, int64_t curTime, v8::Local<v8::Function> _callback, uint32_t _interval, bool _once, V8::SourceLocation&& _location)
+        : isolate(_isolate), lastRun(curTime), callback(_isolate, _callback), interval(_interval), once(_once), location(std::move(_location))
     {
         // Log::Debug << "Create timer: " << curTime << " " << interval << Log::Endl;
     }
 
-    bool Update(int64_t curTime)
+    // The context is owned by the resource and shared by all of its timers
+    bool Update(int64_t curTime, v8::Local<v8::Context> context)
     {
         if(curTime - lastRun >= interval)
         {
             V8Helpers::TryCatch([&] {
-                v8::MaybeLocal<v8::Value> result = callback.Get(isolate)->CallAsFunction(context.Get(isolate), v8::Undefined(isolate), 0, nullptr);
+                v8::MaybeLocal<v8::Value> result = callback.Get(isolate)->CallAsFunction(context, v8::Undefined(isolate), 0, nullptr);
                 return !result.IsEmpty();
             });
 
@@ -41,13 +43,43 @@ public:
     {
         return once;
     }
+    int64_t GetNextRun() const
+    {
+        return lastRun + interval;
+    }
+
+    // Removed timers are kept alive until the next tick, as they might be running
+    void MarkRemoved()
+    {
+        removed = true;
+    }
+    bool IsRemoved() const
+    {
+        return removed;
+    }
+
+    // Timers are recycled through a free list, so setTimeout in a hot loop doesn't hit malloc
+    static void* operator new(size_t)
+    {
+        return Pool().Allocate();
+    }
+    static void operator delete(void* ptr)
+    {
+        Pool().Free(ptr);
+    }
 
 private:
+    static V8::ObjectPool<V8Timer>& Pool()
+    {
+        static V8::ObjectPool<V8Timer> _pool;
+        return _pool;
+    }
+
     v8::Isolate* isolate;
-    V8::CPersistent<v8::Context> context;
     V8::CPersistent<v8::Function> callback;
     int64_t interval;
     int64_t lastRun = 0;
     bool once;
+    bool removed = false;
     V8::SourceLocation location;
 };
@@ -93,10 +93,51 @@ static void RefCountGetter(v8::Local<v8::String>, const v8::PropertyCallbackInfo
     V8_RETURN_UINT(obj->GetRefCount());
 }
 
+// The wrapper of an entity can only be recreated after it was collected while scripts didn't store anything on it,
+// these only run for properties that don't exist yet
+static void PinEntity(const v8::PropertyCallbackInfo<v8::Value>& info)
+{
+    V8Entity* ent = V8Entity::Get(info.Holder());
+    if(ent && !ent->IsPinned()) ent->Pin();
+}
+
+static void PinNamedGetter(v8::Local<v8::Name>, const v8::PropertyCallbackInfo<v8::Value>&) {}
+
+static void PinNamedSetter(v8::Local<v8::Name>, v8::Local<v8::Value>, const v8::PropertyCallbackInfo<v8::Value>& info)
+{
+    PinEntity(info);
+}
+
+static void PinNamedDefiner(v8::Local<v8::Name>, const v8::PropertyDescriptor&, const v8::PropertyCallbackInfo<v8::Value>& info)
+{
+    PinEntity(info);
+}
+
+static void PinIndexedGetter(uint32_t, const v8::PropertyCallbackInfo<v8::Value>&) {}
+
+static void PinIndexedSetter(uint32_t, v8::Local<v8::Value>, const v8::PropertyCallbackInfo<v8::Value>& info)
+{
+    PinEntity(info);
+}
+
+static void PinIndexedDefiner(uint32_t, const v8::PropertyDescriptor&, const v8::PropertyCallbackInfo<v8::Value>& info)
+{
+    PinEntity(info);
+}
+
+static void SetPinHandlers(v8::Local<v8::FunctionTemplate> tpl)
+{
+    v8::Local<v8::ObjectTemplate> instanceTpl = tpl->InstanceTemplate();
+    instanceTpl->SetHandler(v8::NamedPropertyHandlerConfiguration(
+      PinNamedGetter, PinNamedSetter, nullptr, nullptr, nullptr, PinNamedDefiner, nullptr, v8::Local<v8::Value>(), v8::PropertyHandlerFlags::kNonMasking));
+    instanceTpl->SetHandler(v8::IndexedPropertyHandlerConfiguration(
+      PinIndexedGetter, PinIndexedSetter, nullptr, nullptr, nullptr, PinIndexedDefiner, nullptr, v8::Local<v8::Value>(), v8::PropertyHandlerFlags::kNonMasking));
+}
+
 extern V8Class v8BaseObject("BaseObject", [](v8::Local<v8::FunctionTemplate> tpl) {
     v8::Isolate* isolate = v8::Isolate::GetCurrent();
 
-    tpl->InstanceTemplate()->SetInternalFieldCount(1);
+    tpl->InstanceTemplate()->SetInternalFieldCount(V8Entity::InternalFieldCount);
 
     V8::SetAccessor<IBaseObject, IBaseObject::Type, &IBaseObject::GetType>(isolate, tpl, "type");
     V8::SetAccessor(isolate, tpl, "valid", &ValidGetter);
@@ -108,4 +149,7 @@ extern V8Class v8BaseObject("BaseObject", [](v8::Local<v8::FunctionTemplate> tpl
     V8::SetMethod(isolate, tpl, "destroy", Destroy);
 
     V8::SetAccessor(isolate, tpl, "refCount", RefCountGetter);
+
+    // Interceptors slow down every property access on entities, only needed to pin weak wrappers
+    if(V8Entity::IsWeakAllowed()) v8BaseObject.SetInheritedInit(&SetPinHandlers);
 });
@@ -220,7 +220,7 @@ static void SetTimeout(const v8::FunctionCallbackInfo<v8::Value>& info)
     V8_ARG_TO_FUNCTION(1, callback);
     V8_ARG_TO_INT(2, time);
 
-    V8_RETURN_INT(resource->CreateTimer(ctx, callback, time, true, V8::SourceLocation::GetCurrent(isolate)));
+    V8_RETURN_INT(resource->CreateTimer(callback, time, true, V8::SourceLocation::GetCurrent(isolate)));
 }
 
 static void SetInterval(const v8::FunctionCallbackInfo<v8::Value>& info)
@@ -232,7 +232,7 @@ static void SetInterval(const v8::FunctionCallbackInfo<v8::Value>& info)
     V8_ARG_TO_FUNCTION(1, callback);
     V8_ARG_TO_INT(2, time);
 
-    V8_RETURN_INT(resource->CreateTimer(ctx, callback, time, false, V8::SourceLocation::GetCurrent(isolate)));
+    V8_RETURN_INT(resource->CreateTimer(callback, time, false, V8::SourceLocation::GetCurrent(isolate)));
 }
 
 static void NextTick(const v8::FunctionCallbackInfo<v8::Value>& info)
@@ -243,7 +243,7 @@ static void NextTick(const v8::FunctionCallbackInfo<v8::Value>& info)
 
     V8_ARG_TO_FUNCTION(1, callback);
 
-    V8_RETURN_INT(resource->CreateTimer(ctx, callback, 0, true, V8::SourceLocation::GetCurrent(isolate)));
+    V8_RETURN_INT(resource->CreateTimer(callback, 0, true, V8::SourceLocation::GetCurrent(isolate)));
 }
 
 static void EveryTick(const v8::FunctionCallbackInfo<v8::Value>& info)
@@ -254,7 +254,7 @@ static void EveryTick(const v8::FunctionCallbackInfo<v8::Value>& info)
 
     V8_ARG_TO_FUNCTION(1, callback);
 
-    V8_RETURN_INT(resource->CreateTimer(ctx, callback, 0, false, V8::SourceLocation::GetCurrent(isolate)));
+    V8_RETURN_INT(resource->CreateTimer(callback, 0, false, V8::SourceLocation::GetCurrent(isolate)));
 }
 
 static void ClearTimer(const v8::FunctionCallbackInfo<v8::Value>& info)
@@ -289,12 +289,12 @@ static void GetEventListeners(const v8::FunctionCallbackInfo<v8::Value>& info)
 
     if(info[0]->IsNull())
     {
-        handlers = std::move(resource->GetGenericHandlers(true));
+        handlers = resource->GetGenericHandlers(true);
     }
     else
     {
         V8_ARG_TO_STRING(1, eventName);
-        handlers = std::move(resource->GetLocalHandlers(eventName.ToString()));
+        handlers = resource->GetLocalHandlers(eventName.ToString());
     }
 
     auto array = v8::Array::New(isolate, handlers.size());
@@ -315,12 +315,12 @@ static void GetRemoteEventListeners(const v8::FunctionCallbackInfo<v8::Value>& i
 
     if(info[0]->IsNull())
     {
-        handlers = std::move(resource->GetGenericHandlers(false));
+        handlers = resource->GetGenericHandlers(false);
     }
     else
     {
         V8_ARG_TO_STRING(1, eventName);
-        handlers = std::move(resource->GetRemoteHandlers(eventName.ToString()));
+        handlers = resource->GetRemoteHandlers(eventName.ToString());
     }
 
     auto array = v8::Array::New(isolate, handlers.size());
@@ -332,6 +332,38 @@ static void GetRemoteEventListeners(const v8::FunctionCallbackInfo<v8::Value>& i
     V8_RETURN(array);
 }
 
+static v8::Local<v8::Object> LatencyToJS(v8::Isolate* isolate, v8::Local<v8::Context> ctx, const V8::LatencyHistogram& histogram)
+{
+    v8::Local<v8::Object> obj = v8::Object::New(isolate);
+    obj->Set(ctx, V8::JSValue("count"), V8::JSValue((double)histogram.GetCount()));
+    obj->Set(ctx, V8::JSValue("p50"), V8::JSValue(histogram.GetPercentile(50) / 1000.0));
+    obj->Set(ctx, V8::JSValue("p99"), V8::JSValue(histogram.GetPercentile(99) / 1000.0));
+    obj->Set(ctx, V8::JSValue("max"), V8::JSValue(histogram.GetMax() / 1000.0));
+    return obj;
+}
+
+static void GetEventStats(const v8::FunctionCallbackInfo<v8::Value>& info)
+{
+    V8_GET_ISOLATE_CONTEXT_RESOURCE();
+
+    const V8::EventStats& stats = resource->GetEventStats();
+
+    v8::Local<v8::Object> events = v8::Object::New(isolate);
+    for(auto& [id, histogram] : stats.GetEvents()) events->Set(ctx, V8::JSValue(V8::EventIds::GetName(id)), LatencyToJS(isolate, ctx, histogram));
+
+    v8::Local<v8::Object> timers = v8::Object::New(isolate);
+    for(auto& [key, histogram] : stats.GetTimers()) timers->Set(ctx, V8::JSValue(*key.fileName + ":" + std::to_string(key.line)), LatencyToJS(isolate, ctx, histogram));
+
+    // Latencies are in milliseconds
+    v8::Local<v8::Object> result = v8::Object::New(isolate);
+    result->Set(ctx, V8::JSValue("enabled"), V8::JSValue(V8::EventStats::IsEnabled()));
+    result->Set(ctx, V8::JSValue("events"), events);
+    result->Set(ctx, V8::JSValue("genericEvents"), LatencyToJS(isolate, ctx, stats.GetGenericEvents()));
+    result->Set(ctx, V8::JSValue("timers"), timers);
+
+    V8_RETURN(result);
+}
+
 extern V8Class v8BaseObject, v8WorldObject, v8Entity, v8File, v8RGBA, v8Vector2, v8Vector3, v8Blip, v8AreaBlip, v8RadiusBlip, v8PointBlip;
 
 extern V8Module sharedModule("alt-shared",
@@ -353,6 +385,7 @@ extern V8Module sharedModule("alt-shared",
 
                                  V8Helpers::RegisterFunc(exports, "getEventListeners", &GetEventListeners);
                                  V8Helpers::RegisterFunc(exports, "getRemoteEventListeners", &GetRemoteEventListeners);
+                                 V8Helpers::RegisterFunc(exports, "getEventStats", &GetEventStats);
 
                                  V8Helpers::RegisterFunc(exports, "hasMeta", &HasMeta);
                                  V8Helpers::RegisterFunc(exports, "getMeta", &GetMeta);
@@ -7,13 +7,11 @@ static void ToString(const v8::FunctionCallbackInfo<v8::Value>& info)
 {
     V8_GET_ISOLATE_CONTEXT();
 
-    V8_TO_NUMBER(info.This()->Get(ctx, V8::RGBA_RKey(isolate)).ToLocalChecked(), r);
-    V8_TO_NUMBER(info.This()->Get(ctx, V8::RGBA_GKey(isolate)).ToLocalChecked(), g);
-    V8_TO_NUMBER(info.This()->Get(ctx, V8::RGBA_BKey(isolate)).ToLocalChecked(), b);
-    V8_TO_NUMBER(info.This()->Get(ctx, V8::RGBA_AKey(isolate)).ToLocalChecked(), a);
+    alt::RGBA color;
+    V8_CHECK(V8::SafeToRGBA(info.This(), ctx, color), "Failed to convert value to RGBA");
 
     std::ostringstream ss;
-    ss << "RGBA{ r: " << r << ", g: " << g << ", b: " << b << ", a: " << a << " }";
+    ss << "RGBA{ r: " << (int)color.r << ", g: " << (int)color.g << ", b: " << (int)color.b << ", a: " << (int)color.a << " }";
 
     V8_RETURN_STRING(ss.str().c_str());
 }
@@ -33,14 +31,21 @@ static void Constructor(const v8::FunctionCallbackInfo<v8::Value>& info)
     V8_ARG_TO_INT32(4, a);
     V8_CHECK(a >= 0 && a < 256, "Invalid RGBA A value. Allowed is 0 - 255");
 
-    V8::DefineOwnProperty(isolate, ctx, info.This(), V8::RGBA_RKey(isolate), V8::JSValue(r), v8::PropertyAttribute::ReadOnly);
-    V8::DefineOwnProperty(isolate, ctx, info.This(), V8::RGBA_GKey(isolate), V8::JSValue(g), v8::PropertyAttribute::ReadOnly);
-    V8::DefineOwnProperty(isolate, ctx, info.This(), V8::RGBA_BKey(isolate), V8::JSValue(b), v8::PropertyAttribute::ReadOnly);
-    V8::DefineOwnProperty(isolate, ctx, info.This(), V8::RGBA_AKey(isolate), V8::JSValue(a), v8::PropertyAttribute::ReadOnly);
+    info.This()->SetInternalField(0, V8::JSValue(r));
+    info.This()->SetInternalField(1, V8::JSValue(g));
+    info.This()->SetInternalField(2, V8::JSValue(b));
+    info.This()->SetInternalField(3, V8::JSValue(a));
 }
 
 extern V8Class v8RGBA("RGBA", &Constructor, [](v8::Local<v8::FunctionTemplate> tpl) {
     v8::Isolate* isolate = v8::Isolate::GetCurrent();
 
+    // Components are kept in internal fields, r/g/b/a are read only accessors over them
+    tpl->InstanceTemplate()->SetInternalFieldCount(4);
+    V8::SetInstanceAccessor(isolate, tpl, "r", V8::NumberFieldGetter<0>);
+    V8::SetInstanceAccessor(isolate, tpl, "g", V8::NumberFieldGetter<1>);
+    V8::SetInstanceAccessor(isolate, tpl, "b", V8::NumberFieldGetter<2>);
+    V8::SetInstanceAccessor(isolate, tpl, "a", V8::NumberFieldGetter<3>);
+
     V8::SetMethod(isolate, tpl, "toString", ToString);
 });
@@ -12,8 +12,7 @@ static void ToString(const v8::FunctionCallbackInfo<v8::Value>& info)
 
     v8::Local<v8::Object> _this = info.This();
 
-    V8_TO_NUMBER(V8::Get(ctx, _this, V8::Vector3_XKey(isolate)), x);
-    V8_TO_NUMBER(V8::Get(ctx, _this, V8::Vector3_YKey(isolate)), y);
+    V8_TO_XY(_this, x, y);
 
     std::ostringstream ss;
     ss << std::fixed << std::setprecision(4) << "Vector2{ x: " << x << ", y: " << y << " }";
@@ -27,8 +26,7 @@ static void ToArray(const v8::FunctionCallbackInfo<v8::Value>& info)
 
     v8::Local<v8::Object> _this = info.This();
 
-    V8_TO_NUMBER(V8::Get(ctx, _this, V8::Vector3_XKey(isolate)), x);
-    V8_TO_NUMBER(V8::Get(ctx, _this, V8::Vector3_YKey(isolate)), y);
+    V8_TO_XY(_this, x, y);
 
     v8::Local<v8::Array> arr = v8::Array::New(isolate, 2);
     arr->Set(ctx, 0, V8::JSValue(x));
@@ -43,8 +41,7 @@ static void Length(v8::Local<v8::String>, const v8::PropertyCallbackInfo<v8::Val
 
     v8::Local<v8::Object> _this = info.This();
 
-    V8_TO_NUMBER(V8::Get(ctx, _this, V8::Vector3_XKey(isolate)), x);
-    V8_TO_NUMBER(V8::Get(ctx, _this, V8::Vector3_YKey(isolate)), y);
+    V8_TO_XY(_this, x, y);
 
     double length = sqrt(x * x + y * y);
 
@@ -59,8 +56,7 @@ static void Add(const v8::FunctionCallbackInfo<v8::Value>& info)
 
     v8::Local<v8::Object> _this = info.This();
 
-    V8_TO_NUMBER(V8::Get(ctx, _this, V8::Vector3_XKey(isolate)), x);
-    V8_TO_NUMBER(V8::Get(ctx, _this, V8::Vector3_YKey(isolate)), y);
+    V8_TO_XY(_this, x, y);
 
     if(info.Length() == 2)
     {
@@ -90,8 +86,7 @@ static void Add(const v8::FunctionCallbackInfo<v8::Value>& info)
         {
             v8::Local<v8::Object> obj = arg.As<v8::Object>();
 
-            V8_TO_NUMBER(obj->Get(ctx, V8::Vector3_XKey(isolate)).ToLocalChecked(), x2);
-            V8_TO_NUMBER(obj->Get(ctx, V8::Vector3_YKey(isolate)).ToLocalChecked(), y2);
+            V8_TO_XY(obj, x2, y2);
 
             V8_RETURN(resource->CreateVector2({ x + x2, y + y2 }));
         }
@@ -110,8 +105,7 @@ static void Sub(const v8::FunctionCallbackInfo<v8::Value>& info)
 
     v8::Local<v8::Object> _this = info.This();
 
-    V8_TO_NUMBER(V8::Get(ctx, _this, V8::Vector3_XKey(isolate)), x);
-    V8_TO_NUMBER(V8::Get(ctx, _this, V8::Vector3_YKey(isolate)), y);
+    V8_TO_XY(_this, x, y);
 
     if(info.Length() == 2)
     {
@@ -141,8 +135,7 @@ static void Sub(const v8::FunctionCallbackInfo<v8::Value>& info)
         {
             v8::Local<v8::Object> obj = arg.As<v8::Object>();
 
-            V8_TO_NUMBER(obj->Get(ctx, V8::Vector3_XKey(isolate)).ToLocalChecked(), x2);
-            V8_TO_NUMBER(obj->Get(ctx, V8::Vector3_YKey(isolate)).ToLocalChecked(), y2);
+            V8_TO_XY(obj, x2, y2);
 
             V8_RETURN(resource->CreateVector2({ x - x2, y - y2 }));
         }
@@ -161,8 +154,7 @@ static void Divide(const v8::FunctionCallbackInfo<v8::Value>& info)
 
     v8::Local<v8::Object> _this = info.This();
 
-    V8_TO_NUMBER(V8::Get(ctx, _this, V8::Vector3_XKey(isolate)), x);
-    V8_TO_NUMBER(V8::Get(ctx, _this, V8::Vector3_YKey(isolate)), y);
+    V8_TO_XY(_this, x, y);
 
     if(info.Length() == 2)
     {
@@ -195,8 +187,7 @@ static void Divide(const v8::FunctionCallbackInfo<v8::Value>& info)
         {
             v8::Local<v8::Object> obj = arg.As<v8::Object>();
 
-            V8_TO_NUMBER(obj->Get(ctx, V8::Vector3_XKey(isolate)).ToLocalChecked(), x2);
-            V8_TO_NUMBER(obj->Get(ctx, V8::Vector3_YKey(isolate)).ToLocalChecked(), y2);
+            V8_TO_XY(obj, x2, y2);
             V8_CHECK(x2 != 0 && y2 != 0, "Division by zero");
             V8_RETURN(resource->CreateVector2({ x / x2, y / y2 }));
         }
@@ -215,8 +206,7 @@ static void Multiply(const v8::FunctionCallbackInfo<v8::Value>& info)
 
     v8::Local<v8::Object> _this = info.This();
 
-    V8_TO_NUMBER(V8::Get(ctx, _this, V8::Vector3_XKey(isolate)), x);
-    V8_TO_NUMBER(V8::Get(ctx, _this, V8::Vector3_YKey(isolate)), y);
+    V8_TO_XY(_this, x, y);
 
     if(info.Length() == 2)
     {
@@ -246,8 +236,7 @@ static void Multiply(const v8::FunctionCallbackInfo<v8::Value>& info)
         {
             v8::Local<v8::Object> obj = arg.As<v8::Object>();
 
-            V8_TO_NUMBER(obj->Get(ctx, V8::Vector3_XKey(isolate)).ToLocalChecked(), x2);
-            V8_TO_NUMBER(obj->Get(ctx, V8::Vector3_YKey(isolate)).ToLocalChecked(), y2);
+            V8_TO_XY(obj, x2, y2);
 
             V8_RETURN(resource->CreateVector2({ x * x2, y * y2 }));
         }
@@ -266,8 +255,7 @@ static void Dot(const v8::FunctionCallbackInfo<v8::Value>& info)
 
     v8::Local<v8::Object> _this = info.This();
 
-    V8_TO_NUMBER(V8::Get(ctx, _this, V8::Vector3_XKey(isolate)), x);
-    V8_TO_NUMBER(V8::Get(ctx, _this, V8::Vector3_YKey(isolate)), y);
+    V8_TO_XY(_this, x, y);
 
     if(info.Length() == 2)
     {
@@ -299,8 +287,7 @@ static void Dot(const v8::FunctionCallbackInfo<v8::Value>& info)
         {
             v8::Local<v8::Object> obj = arg.As<v8::Object>();
 
-            V8_TO_NUMBER(obj->Get(ctx, V8::Vector3_XKey(isolate)).ToLocalChecked(), x2);
-            V8_TO_NUMBER(obj->Get(ctx, V8::Vector3_YKey(isolate)).ToLocalChecked(), y2);
+            V8_TO_XY(obj, x2, y2);
 
             V8_RETURN_NUMBER(x * x2 + y * y2);
         }
@@ -317,8 +304,7 @@ static void Negative(const v8::FunctionCallbackInfo<v8::Value>& info)
 
     v8::Local<v8::Object> _this = info.This();
 
-    V8_TO_NUMBER(V8::Get(ctx, _this, V8::Vector3_XKey(isolate)), x);
-    V8_TO_NUMBER(V8::Get(ctx, _this, V8::Vector3_YKey(isolate)), y);
+    V8_TO_XY(_this, x, y);
 
     V8_RETURN(resource->CreateVector2({ -x, -y }));
 }
@@ -329,8 +315,7 @@ static void Normalize(const v8::FunctionCallbackInfo<v8::Value>& info)
 
     v8::Local<v8::Object> _this = info.This();
 
-    V8_TO_NUMBER(V8::Get(ctx, _this, V8::Vector3_XKey(isolate)), x);
-    V8_TO_NUMBER(V8::Get(ctx, _this, V8::Vector3_YKey(isolate)), y);
+    V8_TO_XY(_this, x, y);
 
     double length = sqrt(x * x + y * y);
 
@@ -344,13 +329,11 @@ static void DistanceTo(const v8::FunctionCallbackInfo<v8::Value>& info)
 
     v8::Local<v8::Object> _this = info.This();
 
-    V8_TO_NUMBER(V8::Get(ctx, _this, V8::Vector3_XKey(isolate)), x);
-    V8_TO_NUMBER(V8::Get(ctx, _this, V8::Vector3_YKey(isolate)), y);
+    V8_TO_XY(_this, x, y);
 
     V8_ARG_TO_OBJECT(1, vec);
 
-    V8_TO_NUMBER(vec->Get(ctx, V8::Vector3_XKey(isolate)).ToLocalChecked(), x2);
-    V8_TO_NUMBER(vec->Get(ctx, V8::Vector3_YKey(isolate)).ToLocalChecked(), y2);
+    V8_TO_XY(vec, x2, y2);
 
     double xFinal = x - x2;
     double yFinal = y - y2;
@@ -366,13 +349,11 @@ static void AngleTo(const v8::FunctionCallbackInfo<v8::Value>& info)
 
     v8::Local<v8::Object> _this = info.This();
 
-    V8_TO_NUMBER(V8::Get(ctx, _this, V8::Vector3_XKey(isolate)), x);
-    V8_TO_NUMBER(V8::Get(ctx, _this, V8::Vector3_YKey(isolate)), y);
+    V8_TO_XY(_this, x, y);
 
     V8_ARG_TO_OBJECT(1, vec);
 
-    V8_TO_NUMBER(vec->Get(ctx, V8::Vector3_XKey(isolate)).ToLocalChecked(), x2);
-    V8_TO_NUMBER(vec->Get(ctx, V8::Vector3_YKey(isolate)).ToLocalChecked(), y2);
+    V8_TO_XY(vec, x2, y2);
 
     double xy = x * x2 + y * y2;
     double posALength = sqrt(std::pow(x, 2) + std::pow(y, 2));
@@ -398,13 +379,11 @@ static void AngleToDegrees(const v8::FunctionCallbackInfo<v8::Value>& info)
 
     v8::Local<v8::Object> _this = info.This();
 
-    V8_TO_NUMBER(V8::Get(ctx, _this, V8::Vector3_XKey(isolate)), x);
-    V8_TO_NUMBER(V8::Get(ctx, _this, V8::Vector3_YKey(isolate)), y);
+    V8_TO_XY(_this, x, y);
 
     V8_ARG_TO_OBJECT(1, vec);
 
-    V8_TO_NUMBER(vec->Get(ctx, V8::Vector3_XKey(isolate)).ToLocalChecked(), x2);
-    V8_TO_NUMBER(vec->Get(ctx, V8::Vector3_YKey(isolate)).ToLocalChecked(), y2);
+    V8_TO_XY(vec, x2, y2);
 
     double xy = x * x2 + y * y2;
     double posALength = sqrt(std::pow(x, 2) + std::pow(y, 2));
@@ -429,8 +408,7 @@ static void ToDegrees(const v8::FunctionCallbackInfo<v8::Value>& info)
 
     v8::Local<v8::Object> _this = info.This();
 
-    V8_TO_NUMBER(V8::Get(ctx, _this, V8::Vector3_XKey(isolate)), x);
-    V8_TO_NUMBER(V8::Get(ctx, _this, V8::Vector3_YKey(isolate)), y);
+    V8_TO_XY(_this, x, y);
 
     double x2 = (x * 180) / PI;
     double y2 = (y * 180) / PI;
@@ -444,8 +422,7 @@ static void ToRadians(const v8::FunctionCallbackInfo<v8::Value>& info)
 
     v8::Local<v8::Object> _this = info.This();
 
-    V8_TO_NUMBER(V8::Get(ctx, _this, V8::Vector3_XKey(isolate)), x);
-    V8_TO_NUMBER(V8::Get(ctx, _this, V8::Vector3_YKey(isolate)), y);
+    V8_TO_XY(_this, x, y);
 
     double x2 = (x * PI) / 180;
     double y2 = (y * PI) / 180;
@@ -461,14 +438,12 @@ static void IsInRange(const v8::FunctionCallbackInfo<v8::Value>& info)
 
     v8::Local<v8::Object> _this = info.This();
 
-    V8_TO_NUMBER(V8::Get(ctx, _this, V8::Vector3_XKey(isolate)), x);
-    V8_TO_NUMBER(V8::Get(ctx, _this, V8::Vector3_YKey(isolate)), y);
+    V8_TO_XY(_this, x, y);
 
     V8_ARG_TO_OBJECT(1, vec);
     V8_ARG_TO_NUMBER(2, range);
 
-    V8_TO_NUMBER(vec->Get(ctx, V8::Vector3_XKey(isolate)).ToLocalChecked(), x2);
-    V8_TO_NUMBER(vec->Get(ctx, V8::Vector3_YKey(isolate)).ToLocalChecked(), y2);
+    V8_TO_XY(vec, x2, y2);
 
     double dx = abs(x - x2);
     double dy = abs(y - y2);
@@ -628,13 +603,18 @@ static void Constructor(const v8::FunctionCallbackInfo<v8::Value>& info)
         }
     }
 
-    V8::DefineOwnProperty(isolate, ctx, _this, V8::Vector3_XKey(isolate), x, v8::PropertyAttribute::ReadOnly);
-    V8::DefineOwnProperty(isolate, ctx, _this, V8::Vector3_YKey(isolate), y, v8::PropertyAttribute::ReadOnly);
+    _this->SetInternalField(0, x);
+    _this->SetInternalField(1, y);
 }
 
 extern V8Class v8Vector2("Vector2", Constructor, [](v8::Local<v8::FunctionTemplate> tpl) {
     v8::Isolate* isolate = v8::Isolate::GetCurrent();
 
+    // Components are kept in internal fields, x/y are read only accessors over them
+    tpl->InstanceTemplate()->SetInternalFieldCount(2);
+    V8::SetInstanceAccessor(isolate, tpl, "x", V8::NumberFieldGetter<0>);
+    V8::SetInstanceAccessor(isolate, tpl, "y", V8::NumberFieldGetter<1>);
+
     V8::SetStaticAccessor(isolate, tpl, "zero", StaticZero);
     V8::SetStaticAccessor(isolate, tpl, "one", StaticOne);
     V8::SetStaticAccessor(isolate, tpl, "up", StaticUp);
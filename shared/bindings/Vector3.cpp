@@ -1,6 +1,12 @@
 
+#include <cmath>
 #include <iomanip>
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define VECTOR3_SSE
+    #include <emmintrin.h>
+#endif
+
 #include "../V8Class.h"
 #include "../V8Helpers.h"
 #include "../V8ResourceImpl.h"
@@ -13,9 +19,7 @@ static void ToString(const v8::FunctionCallbackInfo<v8::Value>& info)
 
     v8::Local<v8::Object> _this = info.This();
 
-    V8_TO_NUMBER(V8::Get(ctx, _this, V8::Vector3_XKey(isolate)), x);
-    V8_TO_NUMBER(V8::Get(ctx, _this, V8::Vector3_YKey(isolate)), y);
-    V8_TO_NUMBER(V8::Get(ctx, _this, V8::Vector3_ZKey(isolate)), z);
+    V8_TO_XYZ(_this, x, y, z);
 
     std::ostringstream ss;
     ss << std::fixed << std::setprecision(4) << "Vector3{ x: " << x << ", y: " << y << ", z: " << z << " }";
@@ -29,9 +33,7 @@ static void ToArray(const v8::FunctionCallbackInfo<v8::Value>& info)
 
     v8::Local<v8::Object> _this = info.This();
 
-    V8_TO_NUMBER(V8::Get(ctx, _this, V8::Vector3_XKey(isolate)), x);
-    V8_TO_NUMBER(V8::Get(ctx, _this, V8::Vector3_YKey(isolate)), y);
-    V8_TO_NUMBER(V8::Get(ctx, _this, V8::Vector3_ZKey(isolate)), z);
+    V8_TO_XYZ(_this, x, y, z);
 
     v8::Local<v8::Array> arr = v8::Array::New(isolate, 3);
     arr->Set(ctx, 0, V8::JSValue(x));
@@ -47,9 +49,7 @@ static void Length(v8::Local<v8::String>, const v8::PropertyCallbackInfo<v8::Val
 
     v8::Local<v8::Object> _this = info.This();
 
-    V8_TO_NUMBER(V8::Get(ctx, _this, V8::Vector3_XKey(isolate)), x);
-    V8_TO_NUMBER(V8::Get(ctx, _this, V8::Vector3_YKey(isolate)), y);
-    V8_TO_NUMBER(V8::Get(ctx, _this, V8::Vector3_ZKey(isolate)), z);
+    V8_TO_XYZ(_this, x, y, z);
 
     double length = sqrt(x * x + y * y + z * z);
 
@@ -64,9 +64,7 @@ static void Add(const v8::FunctionCallbackInfo<v8::Value>& info)
 
     v8::Local<v8::Object> _this = info.This();
 
-    V8_TO_NUMBER(V8::Get(ctx, _this, V8::Vector3_XKey(isolate)), x);
-    V8_TO_NUMBER(V8::Get(ctx, _this, V8::Vector3_YKey(isolate)), y);
-    V8_TO_NUMBER(V8::Get(ctx, _this, V8::Vector3_ZKey(isolate)), z);
+    V8_TO_XYZ(_this, x, y, z);
 
     if(info.Length() == 3)
     {
@@ -98,9 +96,7 @@ static void Add(const v8::FunctionCallbackInfo<v8::Value>& info)
         {
             v8::Local<v8::Object> obj = arg.As<v8::Object>();
 
-            V8_TO_NUMBER(obj->Get(ctx, V8::Vector3_XKey(isolate)).ToLocalChecked(), x2);
-            V8_TO_NUMBER(obj->Get(ctx, V8::Vector3_YKey(isolate)).ToLocalChecked(), y2);
-            V8_TO_NUMBER(obj->Get(ctx, V8::Vector3_ZKey(isolate)).ToLocalChecked(), z2);
+            V8_TO_XYZ(obj, x2, y2, z2);
 
             V8_RETURN(resource->CreateVector3({ x + x2, y + y2, z + z2 }));
         }
@@ -119,9 +115,7 @@ static void Sub(const v8::FunctionCallbackInfo<v8::Value>& info)
 
     v8::Local<v8::Object> _this = info.This();
 
-    V8_TO_NUMBER(V8::Get(ctx, _this, V8::Vector3_XKey(isolate)), x);
-    V8_TO_NUMBER(V8::Get(ctx, _this, V8::Vector3_YKey(isolate)), y);
-    V8_TO_NUMBER(V8::Get(ctx, _this, V8::Vector3_ZKey(isolate)), z);
+    V8_TO_XYZ(_this, x, y, z);
 
     if(info.Length() == 3)
     {
@@ -153,9 +147,7 @@ static void Sub(const v8::FunctionCallbackInfo<v8::Value>& info)
         {
             v8::Local<v8::Object> obj = arg.As<v8::Object>();
 
-            V8_TO_NUMBER(obj->Get(ctx, V8::Vector3_XKey(isolate)).ToLocalChecked(), x2);
-            V8_TO_NUMBER(obj->Get(ctx, V8::Vector3_YKey(isolate)).ToLocalChecked(), y2);
-            V8_TO_NUMBER(obj->Get(ctx, V8::Vector3_ZKey(isolate)).ToLocalChecked(), z2);
+            V8_TO_XYZ(obj, x2, y2, z2);
 
             V8_RETURN(resource->CreateVector3({ x - x2, y - y2, z - z2 }));
         }
@@ -174,9 +166,7 @@ static void Divide(const v8::FunctionCallbackInfo<v8::Value>& info)
 
     v8::Local<v8::Object> _this = info.This();
 
-    V8_TO_NUMBER(V8::Get(ctx, _this, V8::Vector3_XKey(isolate)), x);
-    V8_TO_NUMBER(V8::Get(ctx, _this, V8::Vector3_YKey(isolate)), y);
-    V8_TO_NUMBER(V8::Get(ctx, _this, V8::Vector3_ZKey(isolate)), z);
+    V8_TO_XYZ(_this, x, y, z);
 
     if(info.Length() == 3)
     {
@@ -211,9 +201,7 @@ static void Divide(const v8::FunctionCallbackInfo<v8::Value>& info)
         {
             v8::Local<v8::Object> obj = arg.As<v8::Object>();
 
-            V8_TO_NUMBER(obj->Get(ctx, V8::Vector3_XKey(isolate)).ToLocalChecked(), x2);
-            V8_TO_NUMBER(obj->Get(ctx, V8::Vector3_YKey(isolate)).ToLocalChecked(), y2);
-            V8_TO_NUMBER(obj->Get(ctx, V8::Vector3_ZKey(isolate)).ToLocalChecked(), z2);
+            V8_TO_XYZ(obj, x2, y2, z2);
             V8_CHECK(x2 != 0 && y2 != 0 && z2 != 0, "Division by zero");
             V8_RETURN(resource->CreateVector3({ x / x2, y / y2, z / z2 }));
         }
@@ -232,9 +220,7 @@ static void Multiply(const v8::FunctionCallbackInfo<v8::Value>& info)
 
     v8::Local<v8::Object> _this = info.This();
 
-    V8_TO_NUMBER(V8::Get(ctx, _this, V8::Vector3_XKey(isolate)), x);
-    V8_TO_NUMBER(V8::Get(ctx, _this, V8::Vector3_YKey(isolate)), y);
-    V8_TO_NUMBER(V8::Get(ctx, _this, V8::Vector3_ZKey(isolate)), z);
+    V8_TO_XYZ(_this, x, y, z);
 
     if(info.Length() == 3)
     {
@@ -266,9 +252,7 @@ static void Multiply(const v8::FunctionCallbackInfo<v8::Value>& info)
         {
             v8::Local<v8::Object> obj = arg.As<v8::Object>();
 
-            V8_TO_NUMBER(obj->Get(ctx, V8::Vector3_XKey(isolate)).ToLocalChecked(), x2);
-            V8_TO_NUMBER(obj->Get(ctx, V8::Vector3_YKey(isolate)).ToLocalChecked(), y2);
-            V8_TO_NUMBER(obj->Get(ctx, V8::Vector3_ZKey(isolate)).ToLocalChecked(), z2);
+            V8_TO_XYZ(obj, x2, y2, z2);
 
             V8_RETURN(resource->CreateVector3({ x * x2, y * y2, z * z2 }));
         }
@@ -287,9 +271,7 @@ static void Dot(const v8::FunctionCallbackInfo<v8::Value>& info)
 
     v8::Local<v8::Object> _this = info.This();
 
-    V8_TO_NUMBER(V8::Get(ctx, _this, V8::Vector3_XKey(isolate)), x);
-    V8_TO_NUMBER(V8::Get(ctx, _this, V8::Vector3_YKey(isolate)), y);
-    V8_TO_NUMBER(V8::Get(ctx, _this, V8::Vector3_ZKey(isolate)), z);
+    V8_TO_XYZ(_this, x, y, z);
 
     if(info.Length() == 3)
     {
@@ -323,9 +305,7 @@ static void Dot(const v8::FunctionCallbackInfo<v8::Value>& info)
         {
             v8::Local<v8::Object> obj = arg.As<v8::Object>();
 
-            V8_TO_NUMBER(obj->Get(ctx, V8::Vector3_XKey(isolate)).ToLocalChecked(), x2);
-            V8_TO_NUMBER(obj->Get(ctx, V8::Vector3_YKey(isolate)).ToLocalChecked(), y2);
-            V8_TO_NUMBER(obj->Get(ctx, V8::Vector3_ZKey(isolate)).ToLocalChecked(), z2);
+            V8_TO_XYZ(obj, x2, y2, z2);
 
             V8_RETURN_NUMBER(x * x2 + y * y2 + z * z2);
         }
@@ -344,9 +324,7 @@ static void Cross(const v8::FunctionCallbackInfo<v8::Value>& info)
 
     v8::Local<v8::Object> _this = info.This();
 
-    V8_TO_NUMBER(V8::Get(ctx, _this, V8::Vector3_XKey(isolate)), x);
-    V8_TO_NUMBER(V8::Get(ctx, _this, V8::Vector3_YKey(isolate)), y);
-    V8_TO_NUMBER(V8::Get(ctx, _this, V8::Vector3_ZKey(isolate)), z);
+    V8_TO_XYZ(_this, x, y, z);
 
     if(info.Length() == 3)
     {
@@ -380,9 +358,7 @@ static void Cross(const v8::FunctionCallbackInfo<v8::Value>& info)
         {
             v8::Local<v8::Object> obj = arg.As<v8::Object>();
 
-            V8_TO_NUMBER(obj->Get(ctx, V8::Vector3_XKey(isolate)).ToLocalChecked(), x2);
-            V8_TO_NUMBER(obj->Get(ctx, V8::Vector3_YKey(isolate)).ToLocalChecked(), y2);
-            V8_TO_NUMBER(obj->Get(ctx, V8::Vector3_ZKey(isolate)).ToLocalChecked(), z2);
+            V8_TO_XYZ(obj, x2, y2, z2);
 
             V8_RETURN(resource->CreateVector3({ (y * z2) - (z * y2), (z * x2) - (x * z2), (x * y2) - (y * x2) }));
         }
@@ -399,9 +375,7 @@ static void Negative(const v8::FunctionCallbackInfo<v8::Value>& info)
 
     v8::Local<v8::Object> _this = info.This();
 
-    V8_TO_NUMBER(V8::Get(ctx, _this, V8::Vector3_XKey(isolate)), x);
-    V8_TO_NUMBER(V8::Get(ctx, _this, V8::Vector3_YKey(isolate)), y);
-    V8_TO_NUMBER(V8::Get(ctx, _this, V8::Vector3_ZKey(isolate)), z);
+    V8_TO_XYZ(_this, x, y, z);
 
     V8_RETURN(resource->CreateVector3({ -x, -y, -z }));
 }
@@ -412,9 +386,7 @@ static void Normalize(const v8::FunctionCallbackInfo<v8::Value>& info)
 
     v8::Local<v8::Object> _this = info.This();
 
-    V8_TO_NUMBER(V8::Get(ctx, _this, V8::Vector3_XKey(isolate)), x);
-    V8_TO_NUMBER(V8::Get(ctx, _this, V8::Vector3_YKey(isolate)), y);
-    V8_TO_NUMBER(V8::Get(ctx, _this, V8::Vector3_ZKey(isolate)), z);
+    V8_TO_XYZ(_this, x, y, z);
 
     double length = sqrt(x * x + y * y + z * z);
 
@@ -428,15 +400,11 @@ static void DistanceTo(const v8::FunctionCallbackInfo<v8::Value>& info)
 
     v8::Local<v8::Object> _this = info.This();
 
-    V8_TO_NUMBER(V8::Get(ctx, _this, V8::Vector3_XKey(isolate)), x);
-    V8_TO_NUMBER(V8::Get(ctx, _this, V8::Vector3_YKey(isolate)), y);
-    V8_TO_NUMBER(V8::Get(ctx, _this, V8::Vector3_ZKey(isolate)), z);
+    V8_TO_XYZ(_this, x, y, z);
 
     V8_ARG_TO_OBJECT(1, vec);
 
-    V8_TO_NUMBER(vec->Get(ctx, V8::Vector3_XKey(isolate)).ToLocalChecked(), x2);
-    V8_TO_NUMBER(vec->Get(ctx, V8::Vector3_YKey(isolate)).ToLocalChecked(), y2);
-    V8_TO_NUMBER(vec->Get(ctx, V8::Vector3_ZKey(isolate)).ToLocalChecked(), z2);
+    V8_TO_XYZ(vec, x2, y2, z2);
 
     double xFinal = x - x2;
     double yFinal = y - y2;
@@ -453,15 +421,11 @@ static void AngleTo(const v8::FunctionCallbackInfo<v8::Value>& info)
 
     v8::Local<v8::Object> _this = info.This();
 
-    V8_TO_NUMBER(V8::Get(ctx, _this, V8::Vector3_XKey(isolate)), x);
-    V8_TO_NUMBER(V8::Get(ctx, _this, V8::Vector3_YKey(isolate)), y);
-    V8_TO_NUMBER(V8::Get(ctx, _this, V8::Vector3_ZKey(isolate)), z);
+    V8_TO_XYZ(_this, x, y, z);
 
     V8_ARG_TO_OBJECT(1, vec);
 
-    V8_TO_NUMBER(vec->Get(ctx, V8::Vector3_XKey(isolate)).ToLocalChecked(), x2);
-    V8_TO_NUMBER(vec->Get(ctx, V8::Vector3_YKey(isolate)).ToLocalChecked(), y2);
-    V8_TO_NUMBER(vec->Get(ctx, V8::Vector3_ZKey(isolate)).ToLocalChecked(), z2);
+    V8_TO_XYZ(vec, x2, y2, z2);
 
     double xy = x * x2 + y * y2;
     double posALength = sqrt(std::pow(x, 2) + std::pow(y, 2));
@@ -487,15 +451,11 @@ static void AngleToDegrees(const v8::FunctionCallbackInfo<v8::Value>& info)
 
     v8::Local<v8::Object> _this = info.This();
 
-    V8_TO_NUMBER(V8::Get(ctx, _this, V8::Vector3_XKey(isolate)), x);
-    V8_TO_NUMBER(V8::Get(ctx, _this, V8::Vector3_YKey(isolate)), y);
-    V8_TO_NUMBER(V8::Get(ctx, _this, V8::Vector3_ZKey(isolate)), z);
+    V8_TO_XYZ(_this, x, y, z);
 
     V8_ARG_TO_OBJECT(1, vec);
 
-    V8_TO_NUMBER(vec->Get(ctx, V8::Vector3_XKey(isolate)).ToLocalChecked(), x2);
-    V8_TO_NUMBER(vec->Get(ctx, V8::Vector3_YKey(isolate)).ToLocalChecked(), y2);
-    V8_TO_NUMBER(vec->Get(ctx, V8::Vector3_ZKey(isolate)).ToLocalChecked(), z2);
+    V8_TO_XYZ(vec, x2, y2, z2);
 
     double xy = x * x2 + y * y2;
     double posALength = sqrt(std::pow(x, 2) + std::pow(y, 2));
@@ -520,9 +480,7 @@ static void ToDegrees(const v8::FunctionCallbackInfo<v8::Value>& info)
 
     v8::Local<v8::Object> _this = info.This();
 
-    V8_TO_NUMBER(V8::Get(ctx, _this, V8::Vector3_XKey(isolate)), x);
-    V8_TO_NUMBER(V8::Get(ctx, _this, V8::Vector3_YKey(isolate)), y);
-    V8_TO_NUMBER(V8::Get(ctx, _this, V8::Vector3_ZKey(isolate)), z);
+    V8_TO_XYZ(_this, x, y, z);
 
     double x2 = (x * 180) / PI;
     double y2 = (y * 180) / PI;
@@ -537,9 +495,7 @@ static void ToRadians(const v8::FunctionCallbackInfo<v8::Value>& info)
 
     v8::Local<v8::Object> _this = info.This();
 
-    V8_TO_NUMBER(V8::Get(ctx, _this, V8::Vector3_XKey(isolate)), x);
-    V8_TO_NUMBER(V8::Get(ctx, _this, V8::Vector3_YKey(isolate)), y);
-    V8_TO_NUMBER(V8::Get(ctx, _this, V8::Vector3_ZKey(isolate)), z);
+    V8_TO_XYZ(_this, x, y, z);
 
     double x2 = (x * PI) / 180;
     double y2 = (y * PI) / 180;
@@ -556,16 +512,12 @@ static void IsInRange(const v8::FunctionCallbackInfo<v8::Value>& info)
 
     v8::Local<v8::Object> _this = info.This();
 
-    V8_TO_NUMBER(V8::Get(ctx, _this, V8::Vector3_XKey(isolate)), x);
-    V8_TO_NUMBER(V8::Get(ctx, _this, V8::Vector3_YKey(isolate)), y);
-    V8_TO_NUMBER(V8::Get(ctx, _this, V8::Vector3_ZKey(isolate)), z);
+    V8_TO_XYZ(_this, x, y, z);
 
     V8_ARG_TO_OBJECT(1, vec);
     V8_ARG_TO_NUMBER(2, range);
 
-    V8_TO_NUMBER(vec->Get(ctx, V8::Vector3_XKey(isolate)).ToLocalChecked(), x2);
-    V8_TO_NUMBER(vec->Get(ctx, V8::Vector3_YKey(isolate)).ToLocalChecked(), y2);
-    V8_TO_NUMBER(vec->Get(ctx, V8::Vector3_ZKey(isolate)).ToLocalChecked(), z2);
+    V8_TO_XYZ(vec, x2, y2, z2);
 
     double dx = abs(x - x2);
     double dy = abs(y - y2);
@@ -595,6 +547,73 @@ static void Lerp(const v8::FunctionCallbackInfo<v8::Value>& info)
     V8_RETURN_VECTOR3(lerpedVector);
 }
 
+#ifdef V8_FAST_API_CALLS
+// Components of a Vector3 instance for the fast callbacks, plain objects and arrays fall back to the slow callbacks.
+// Vector3 is the only template with three internal fields
+static bool FastToXYZ(v8::Local<v8::Value> val, double& x, double& y, double& z)
+{
+    if(!val->IsObject()) return false;
+
+    v8::Local<v8::Object> obj = val.As<v8::Object>();
+    if(obj->InternalFieldCount() != 3) return false;
+
+    // Reading the fields creates handles, fast callbacks don't have a scope open
+    v8::HandleScope scope(obj->GetIsolate());
+    v8::Local<v8::Value> fx = obj->GetInternalField(0);
+    v8::Local<v8::Value> fy = obj->GetInternalField(1);
+    v8::Local<v8::Value> fz = obj->GetInternalField(2);
+    if(!fx->IsNumber() || !fy->IsNumber() || !fz->IsNumber()) return false;
+
+    x = fx.As<v8::Number>()->Value();
+    y = fy.As<v8::Number>()->Value();
+    z = fz.As<v8::Number>()->Value();
+    return true;
+}
+
+static double FastDistanceTo(v8::Local<v8::Object> receiver, v8::Local<v8::Value> vec, v8::FastApiCallbackOptions& options)
+{
+    double x, y, z, x2, y2, z2;
+    if(!FastToXYZ(receiver, x, y, z) || !FastToXYZ(vec, x2, y2, z2))
+    {
+        options.fallback = true;
+        return 0;
+    }
+
+    double xFinal = x - x2;
+    double yFinal = y - y2;
+    double zFinal = z - z2;
+    return sqrt((xFinal * xFinal) + (yFinal * yFinal) + (zFinal * zFinal));
+}
+
+static bool FastIsInRange(v8::Local<v8::Object> receiver, v8::Local<v8::Value> vec, double range, v8::FastApiCallbackOptions& options)
+{
+    double x, y, z, x2, y2, z2;
+    if(!FastToXYZ(receiver, x, y, z) || !FastToXYZ(vec, x2, y2, z2))
+    {
+        options.fallback = true;
+        return false;
+    }
+
+    double dx = abs(x - x2);
+    double dy = abs(y - y2);
+    double dz = abs(z - z2);
+
+    return dx <= range && dy <= range && dz <= range && dx * dx + dy * dy + dz * dz <= range * range;
+}
+
+static double FastDot(v8::Local<v8::Object> receiver, v8::Local<v8::Value> vec, v8::FastApiCallbackOptions& options)
+{
+    double x, y, z, x2, y2, z2;
+    if(!FastToXYZ(receiver, x, y, z) || !FastToXYZ(vec, x2, y2, z2))
+    {
+        options.fallback = true;
+        return 0;
+    }
+
+    return x * x2 + y * y2 + z * z2;
+}
+#endif
+
 static void StaticZero(v8::Local<v8::String>, const v8::PropertyCallbackInfo<v8::Value>& info)
 {
     V8_GET_ISOLATE();
@@ -689,6 +708,219 @@ static void StaticPositiveInfinity(v8::Local<v8::String>, const v8::PropertyCall
     V8_RETURN(positiveInfinity.Get(isolate));
 }
 
+// Packed x, y, z components of a Float32Array or Float64Array
+struct PackedVectors
+{
+    void* data = nullptr;
+    size_t length = 0;
+    bool isDouble = false;
+};
+
+static bool ToPackedVectors(v8::Local<v8::Value> val, PackedVectors& out)
+{
+    if(!val->IsFloat32Array() && !val->IsFloat64Array()) return false;
+
+    v8::Local<v8::TypedArray> arr = val.As<v8::TypedArray>();
+    out.data = V8::GetTypedArrayData(arr);
+    out.length = arr->Length();
+    out.isDouble = val->IsFloat64Array();
+    return true;
+}
+
+// T is the precision the values are computed in, the SSE paths handle their tail in float,
+// so every point of a batch gets the same result regardless of its index
+template<typename T, typename In, typename Out>
+static void DistancesScalar(const In* points, size_t begin, size_t count, const T origin[3], Out* out)
+{
+    for(size_t i = begin; i < count; ++i)
+    {
+        T dx = (T)points[i * 3] - origin[0];
+        T dy = (T)points[i * 3 + 1] - origin[1];
+        T dz = (T)points[i * 3 + 2] - origin[2];
+        out[i] = (Out)std::sqrt((dx * dx + dy * dy) + dz * dz);
+    }
+}
+
+// Row major 3x4 affine part of the matrix, summed in the same order as the SSE path
+template<typename T, typename In, typename Out>
+static void TransformScalar(const In* points, size_t begin, size_t count, const T m[12], Out* out)
+{
+    for(size_t i = begin; i < count; ++i)
+    {
+        T x = (T)points[i * 3];
+        T y = (T)points[i * 3 + 1];
+        T z = (T)points[i * 3 + 2];
+
+        out[i * 3] = (Out)((m[0] * x + m[1] * y) + (m[2] * z + m[3]));
+        out[i * 3 + 1] = (Out)((m[4] * x + m[5] * y) + (m[6] * z + m[7]));
+        out[i * 3 + 2] = (Out)((m[8] * x + m[9] * y) + (m[10] * z + m[11]));
+    }
+}
+
+template<typename In, typename Out>
+static void Distances(const In* points, size_t count, const double origin[3], Out* out)
+{
+    DistancesScalar(points, 0, count, origin, out);
+}
+
+template<typename In, typename Out>
+static void Transform(const In* points, size_t count, const double m[12], Out* out)
+{
+    TransformScalar(points, 0, count, m, out);
+}
+
+#ifdef VECTOR3_SSE
+// Deinterleaves 4 packed points into their x, y and z lanes
+static inline void LoadPoints4(const float* points, __m128& x, __m128& y, __m128& z)
+{
+    __m128 a = _mm_loadu_ps(points);      // x0 y0 z0 x1
+    __m128 b = _mm_loadu_ps(points + 4);  // y1 z1 x2 y2
+    __m128 c = _mm_loadu_ps(points + 8);  // z2 x3 y3 z3
+
+    x = _mm_shuffle_ps(a, _mm_shuffle_ps(b, c, _MM_SHUFFLE(0, 1, 0, 2)), _MM_SHUFFLE(2, 0, 3, 0));
+    y = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 0, 0, 1)), _mm_shuffle_ps(b, c, _MM_SHUFFLE(0, 2, 0, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+    z = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 1, 0, 2)), _mm_shuffle_ps(c, c, _MM_SHUFFLE(0, 3, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+}
+
+template<>
+void Distances<float, float>(const float* points, size_t count, const double origin[3], float* out)
+{
+    const float originF[3] = { (float)origin[0], (float)origin[1], (float)origin[2] };
+    __m128 ox = _mm_set1_ps(originF[0]);
+    __m128 oy = _mm_set1_ps(originF[1]);
+    __m128 oz = _mm_set1_ps(originF[2]);
+
+    size_t i = 0;
+    for(; i + 4 <= count; i += 4)
+    {
+        __m128 x, y, z;
+        LoadPoints4(points + i * 3, x, y, z);
+
+        x = _mm_sub_ps(x, ox);
+        y = _mm_sub_ps(y, oy);
+        z = _mm_sub_ps(z, oz);
+
+        __m128 sum = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)), _mm_mul_ps(z, z));
+        _mm_storeu_ps(out + i, _mm_sqrt_ps(sum));
+    }
+
+    DistancesScalar(points, i, count, originF, out);
+}
+
+template<>
+void Transform<float, float>(const float* points, size_t count, const double m[12], float* out)
+{
+    float mF[12];
+    __m128 r[12];
+    for(int j = 0; j < 12; ++j)
+    {
+        mF[j] = (float)m[j];
+        r[j] = _mm_set1_ps(mF[j]);
+    }
+
+    size_t i = 0;
+    for(; i + 4 <= count; i += 4)
+    {
+        __m128 x, y, z;
+        LoadPoints4(points + i * 3, x, y, z);
+
+        alignas(16) float res[3][4];
+        _mm_store_ps(res[0], _mm_add_ps(_mm_add_ps(_mm_mul_ps(r[0], x), _mm_mul_ps(r[1], y)), _mm_add_ps(_mm_mul_ps(r[2], z), r[3])));
+        _mm_store_ps(res[1], _mm_add_ps(_mm_add_ps(_mm_mul_ps(r[4], x), _mm_mul_ps(r[5], y)), _mm_add_ps(_mm_mul_ps(r[6], z), r[7])));
+        _mm_store_ps(res[2], _mm_add_ps(_mm_add_ps(_mm_mul_ps(r[8], x), _mm_mul_ps(r[9], y)), _mm_add_ps(_mm_mul_ps(r[10], z), r[11])));
+
+        // Written after all 4 points were loaded, so out may alias points
+        for(int j = 0; j < 4; ++j)
+        {
+            out[(i + j) * 3] = res[0][j];
+            out[(i + j) * 3 + 1] = res[1][j];
+            out[(i + j) * 3 + 2] = res[2][j];
+        }
+    }
+
+    TransformScalar(points, i, count, mF, out);
+}
+#endif
+
+template<typename Fn>
+static void DispatchPacked(const PackedVectors& in, const PackedVectors& out, Fn&& fn)
+{
+    if(in.isDouble)
+    {
+        if(out.isDouble)
+            fn(static_cast<const double*>(in.data), static_cast<double*>(out.data));
+        else
+            fn(static_cast<const double*>(in.data), static_cast<float*>(out.data));
+    }
+    else
+    {
+        if(out.isDouble)
+            fn(static_cast<const float*>(in.data), static_cast<double*>(out.data));
+        else
+            fn(static_cast<const float*>(in.data), static_cast<float*>(out.data));
+    }
+}
+
+// Vector3.distancesTo(origin, positions, out), positions are packed x, y, z components
+static void StaticDistancesTo(const v8::FunctionCallbackInfo<v8::Value>& info)
+{
+    V8_GET_ISOLATE_CONTEXT();
+    V8_CHECK_ARGS_LEN(3);
+
+    V8_ARG_TO_OBJECT(1, origin);
+    V8_TO_XYZ(origin, x, y, z);
+
+    PackedVectors positions, out;
+    V8_CHECK(ToPackedVectors(info[1], positions), "Argument 2 must be a Float32Array or Float64Array");
+    V8_CHECK(ToPackedVectors(info[2], out), "Argument 3 must be a Float32Array or Float64Array");
+    V8_CHECK(positions.length % 3 == 0, "Positions length must be a multiple of 3");
+
+    size_t count = positions.length / 3;
+    V8_CHECK(out.length >= count, "Output array is too small");
+
+    double originXYZ[3] = { x, y, z };
+    DispatchPacked(positions, out, [&](auto points, auto result) { Distances(points, count, originXYZ, result); });
+
+    V8_RETURN_NUMBER(count);
+}
+
+// Vector3.transformMany(positions, matrix, out), matrix is a column major 4x4 affine matrix,
+// out may be the positions array itself
+static void StaticTransformMany(const v8::FunctionCallbackInfo<v8::Value>& info)
+{
+    V8_GET_ISOLATE_CONTEXT();
+    V8_CHECK_ARGS_LEN(3);
+
+    PackedVectors positions, out;
+    V8_CHECK(ToPackedVectors(info[0], positions), "Argument 1 must be a Float32Array or Float64Array");
+    V8_ARG_TO_OBJECT(2, matrix);
+    V8_CHECK(ToPackedVectors(info[2], out), "Argument 3 must be a Float32Array or Float64Array");
+    V8_CHECK(positions.length % 3 == 0, "Positions length must be a multiple of 3");
+    V8_CHECK(out.length >= positions.length, "Output array is too small");
+
+    uint32_t matrixLength = 0;
+    if(matrix->IsArray()) matrixLength = matrix.As<v8::Array>()->Length();
+    else if(matrix->IsTypedArray())
+        matrixLength = (uint32_t)matrix.As<v8::TypedArray>()->Length();
+    V8_CHECK(matrixLength == 16, "Matrix must be an array of 16 numbers");
+
+    double m[12];
+    for(uint32_t col = 0; col < 4; ++col)
+    {
+        for(uint32_t row = 0; row < 3; ++row)
+        {
+            v8::Local<v8::Value> val;
+            V8_CHECK(matrix->Get(ctx, col * 4 + row).ToLocal(&val), "Matrix must be an array of 16 numbers");
+            V8_CHECK(V8::SafeToNumber(val, ctx, m[row * 4 + col]), "Matrix must be an array of 16 numbers");
+        }
+    }
+
+    size_t count = positions.length / 3;
+    DispatchPacked(positions, out, [&](auto points, auto result) { Transform(points, count, m, result); });
+
+    V8_RETURN_NUMBER(count);
+}
+
 static void Constructor(const v8::FunctionCallbackInfo<v8::Value>& info)
 {
     V8_GET_ISOLATE_CONTEXT();
@@ -752,14 +984,20 @@ static void Constructor(const v8::FunctionCallbackInfo<v8::Value>& info)
         }
     }
 
-    V8::DefineOwnProperty(isolate, ctx, _this, V8::Vector3_XKey(isolate), x, v8::PropertyAttribute::ReadOnly);
-    V8::DefineOwnProperty(isolate, ctx, _this, V8::Vector3_YKey(isolate), y, v8::PropertyAttribute::ReadOnly);
-    V8::DefineOwnProperty(isolate, ctx, _this, V8::Vector3_ZKey(isolate), z, v8::PropertyAttribute::ReadOnly);
+    _this->SetInternalField(0, x);
+    _this->SetInternalField(1, y);
+    _this->SetInternalField(2, z);
 }
 
 extern V8Class v8Vector3("Vector3", Constructor, [](v8::Local<v8::FunctionTemplate> tpl) {
     v8::Isolate* isolate = v8::Isolate::GetCurrent();
 
+    // Components are kept in internal fields, x/y/z are read only accessors over them
+    tpl->InstanceTemplate()->SetInternalFieldCount(3);
+    V8::SetInstanceAccessor(isolate, tpl, "x", V8::NumberFieldGetter<0>);
+    V8::SetInstanceAccessor(isolate, tpl, "y", V8::NumberFieldGetter<1>);
+    V8::SetInstanceAccessor(isolate, tpl, "z", V8::NumberFieldGetter<2>);
+
     V8::SetStaticAccessor(isolate, tpl, "zero", StaticZero);
     V8::SetStaticAccessor(isolate, tpl, "one", StaticOne);
     V8::SetStaticAccessor(isolate, tpl, "back", StaticBack);
@@ -771,6 +1009,9 @@ extern V8Class v8Vector3("Vector3", Constructor, [](v8::Local<v8::FunctionTempla
     V8::SetStaticAccessor(isolate, tpl, "negativeInfinity", StaticNegativeInfinity);
     V8::SetStaticAccessor(isolate, tpl, "positiveInfinity", StaticPositiveInfinity);
 
+    V8::SetStaticMethod(isolate, tpl, "distancesTo", StaticDistancesTo);
+    V8::SetStaticMethod(isolate, tpl, "transformMany", StaticTransformMany);
+
     V8::SetAccessor(isolate, tpl, "length", Length);
     V8::SetMethod(isolate, tpl, "toString", ToString);
     V8::SetMethod(isolate, tpl, "toArray", ToArray);
@@ -778,15 +1019,15 @@ extern V8Class v8Vector3("Vector3", Constructor, [](v8::Local<v8::FunctionTempla
     V8::SetMethod(isolate, tpl, "sub", Sub);
     V8::SetMethod(isolate, tpl, "div", Divide);
     V8::SetMethod(isolate, tpl, "mul", Multiply);
-    V8::SetMethod(isolate, tpl, "dot", Dot);
+    V8::SetFastMethod(isolate, tpl, "dot", Dot, V8_FAST_CALLBACK(FastDot));
     V8::SetMethod(isolate, tpl, "cross", Cross);
     V8::SetMethod(isolate, tpl, "negative", Negative);
     V8::SetMethod(isolate, tpl, "normalize", Normalize);
-    V8::SetMethod(isolate, tpl, "distanceTo", DistanceTo);
+    V8::SetFastMethod(isolate, tpl, "distanceTo", DistanceTo, V8_FAST_CALLBACK(FastDistanceTo));
     V8::SetMethod(isolate, tpl, "angleTo", AngleTo);
     V8::SetMethod(isolate, tpl, "angleToDegrees", AngleToDegrees);
     V8::SetMethod(isolate, tpl, "toRadians", ToRadians);
     V8::SetMethod(isolate, tpl, "toDegrees", ToDegrees);
-    V8::SetMethod(isolate, tpl, "isInRange", IsInRange);
+    V8::SetFastMethod(isolate, tpl, "isInRange", IsInRange, V8_FAST_CALLBACK(FastIsInRange));
     V8::SetMethod(isolate, tpl, "lerp", Lerp);
 });
@@ -6,7 +6,7 @@
 
 using EventType = alt::CEvent::Type;
 
-V8_LOCAL_EVENT_HANDLER consoleCommand(EventType::CONSOLE_COMMAND_EVENT, "consoleCommand", [](V8ResourceImpl* resource, const alt::CEvent* e, std::vector<v8::Local<v8::Value>>& args) {
+V8_LOCAL_EVENT_HANDLER consoleCommand(EventType::CONSOLE_COMMAND_EVENT, "consoleCommand", [](V8ResourceImpl* resource, const alt::CEvent* e, V8::EventArgs& args) {
     auto ev = static_cast<const alt::CConsoleCommandEvent*>(e);
     v8::Isolate* isolate = resource->GetIsolate();
 